@@ -0,0 +1,366 @@
+/**
+ * @file        ContainerBenchmark.cpp
+ * @details     Microbenchmark suite for the Array, Queue and Stack containers.
+ *              Each benchmark is run over a matrix of element types and capacities.
+ *              Results are printed as CSV lines so that they can be collected and compared between releases:
+ *              container,operation,type,capacity,operations,ticks,ticks_per_op,unit
+ *              On Cortex-M targets with a DWT unit, ticks are CPU cycles.
+ *              On other targets, ticks are nanoseconds measured with std::chrono::steady_clock.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ * @note        Define BENCHMARK_NO_MAIN to call RunContainerBenchmarks() from an existing firmware.
+ *              printf should be retargeted (e.g. to a UART) on bare metal targets.
+ * @note        Define BENCHMARK_REPETITIONS to change the number of runs per measurement.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <cstdint>      // Fixed width integer types
+#include <cstdio>       // std::printf
+#include "../Containers/ArrayContainer.h"
+#include "../Containers/QueueContainer.h"
+#include "../Containers/StackContainer.h"
+
+/*** Special definitions ***/
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#define BENCHMARK_DWT_CLOCK
+#else
+#include <chrono>       // std::chrono::steady_clock
+#endif
+
+#ifndef BENCHMARK_REPETITIONS
+#define BENCHMARK_REPETITIONS 1000
+#endif
+
+namespace {
+
+/*** Tick Source ***/
+#ifdef BENCHMARK_DWT_CLOCK
+/**
+ * @brief   CPU cycle counter of the Data Watchpoint and Trace unit
+ * @note    Cortex-M0/M0+ cores have no cycle counter, the host clock is used there.
+ */
+class TickSource{
+public:
+    static constexpr const char* unit = "cycles";
+
+    static void Init()
+    {
+        DEMCR       = DEMCR | (1u << 24);   // TRCENA: Enable the DWT unit
+        DWT_CYCCNT  = 0;
+        DWT_CTRL    = DWT_CTRL | 1u;        // CYCCNTENA: Enable the cycle counter
+    }
+
+    static std::uint32_t Now() { return DWT_CYCCNT; }
+
+private:
+    static inline volatile std::uint32_t& DEMCR         = *reinterpret_cast<volatile std::uint32_t*>(0xE000EDFCu);
+    static inline volatile std::uint32_t& DWT_CTRL      = *reinterpret_cast<volatile std::uint32_t*>(0xE0001000u);
+    static inline volatile std::uint32_t& DWT_CYCCNT    = *reinterpret_cast<volatile std::uint32_t*>(0xE0001004u);
+};
+#else
+/**
+ * @brief   Monotonic host clock with nanosecond resolution
+ */
+class TickSource{
+public:
+    static constexpr const char* unit = "ns";
+
+    static void Init() { /* No operation */ }
+
+    static std::uint64_t Now()
+    {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+};
+#endif
+
+/*** Helper Functions ***/
+/**
+ * @brief   Prevents the compiler from discarding the computation of the given value
+ */
+template<class T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief   Runs the benchmark body repeatedly and prints a CSV line
+ * @param   container       Name of the benchmarked container
+ * @param   operation       Name of the benchmarked operation
+ * @param   typeName        Name of the element type
+ * @param   capacity        Capacity of the container
+ * @param   opsPerRun       Number of operations performed by a single run of the body
+ * @param   body            Benchmark body
+ */
+template<class BodyT>
+void Measure(const char* container, const char* operation, const char* typeName,
+             const std::size_t capacity, const std::size_t opsPerRun, BodyT&& body)
+{
+    body(); // Warm-up run
+
+    const auto start = TickSource::Now();
+
+    for(std::size_t run = 0; run < BENCHMARK_REPETITIONS; ++run)
+        body();
+
+    const auto ticks = static_cast<unsigned long long>(TickSource::Now() - start);
+    const auto ops   = static_cast<unsigned long long>(opsPerRun) * BENCHMARK_REPETITIONS;
+
+    std::printf("%s,%s,%s,%u,%llu,%llu,%.3f,%s\n", container, operation, typeName, static_cast<unsigned>(capacity),
+                ops, ticks, (0 == ops) ? 0.0 : static_cast<double>(ticks) / static_cast<double>(ops), TickSource::unit);
+}
+
+/*** Element Types ***/
+/**
+ * @brief   Plain sensor sample, trivially copyable
+ */
+struct PodSample{
+    std::uint32_t timestamp;
+    std::int16_t  x, y, z;
+    std::uint16_t flags;
+
+    PodSample() = default;
+    explicit PodSample(const std::size_t seed)
+        : timestamp(static_cast<std::uint32_t>(seed)), x(1), y(2), z(3), flags(static_cast<std::uint16_t>(seed)) { }
+
+    bool operator==(const PodSample& other) const { return (timestamp == other.timestamp) && (flags == other.flags); }
+    bool operator!=(const PodSample& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief   Element with user provided copy, move and destruction, e.g. a reference counted handle
+ */
+class NonTrivial{
+public:
+    NonTrivial() = default;
+    explicit NonTrivial(const std::size_t seed) : value(static_cast<std::uint32_t>(seed)) { /* No operation */ }
+    NonTrivial(const NonTrivial& other) : value(other.value) { /* No operation */ }
+    NonTrivial(NonTrivial&& other) noexcept : value(other.value) { other.value = 0; }
+    NonTrivial& operator=(const NonTrivial& other) { value = other.value; return *this; }
+    NonTrivial& operator=(NonTrivial&& other) noexcept { value = other.value; other.value = 0; return *this; }
+    ~NonTrivial() { /* No operation */ }   // User provided, keeps the type non-trivially destructible
+
+    bool operator==(const NonTrivial& other) const { return (value == other.value); }
+    bool operator!=(const NonTrivial& other) const { return !(*this == other); }
+
+private:
+    std::uint32_t value{0};
+};
+
+template<class T> constexpr const char* TypeName();
+template<> constexpr const char* TypeName<std::uint8_t>()   { return "uint8_t";     }
+template<> constexpr const char* TypeName<PodSample>()      { return "PodSample";   }
+template<> constexpr const char* TypeName<NonTrivial>()     { return "NonTrivial";  }
+
+/*** Benchmarks ***/
+/**
+ * @brief   Queue throughput as well as copy, swap and assignment cost
+ */
+template<class T, std::size_t SIZE>
+void BenchmarkQueue()
+{
+    static Queue<T, SIZE> queue, other;
+    static T buffer[SIZE];
+    const char* typeName = TypeName<T>();
+
+    for(std::size_t index = 0; index < SIZE; ++index)
+        buffer[index] = T(index);
+
+    Measure("Queue", "push_pop", typeName, SIZE, 2 * SIZE, [&]{
+        for(std::size_t index = 0; index < SIZE; ++index)
+            queue.push(buffer[index]);
+
+        DoNotOptimize(queue);
+
+        while(!queue.empty())
+            queue.pop();
+    });
+
+    Measure("Queue", "emplace_pop", typeName, SIZE, 2 * SIZE, [&]{
+        for(std::size_t index = 0; index < SIZE; ++index)
+            queue.emplace(index);
+
+        DoNotOptimize(queue);
+
+        while(!queue.empty())
+            queue.pop();
+    });
+
+    Measure("Queue", "push_n_pop_n", typeName, SIZE, 2 * SIZE, [&]{
+        queue.push_n(buffer, SIZE);
+        DoNotOptimize(queue);
+        queue.pop_n(buffer, SIZE);
+        DoNotOptimize(buffer);
+    });
+
+    // Keep the ring wrapped around for the copy benchmarks
+    queue.push_n(buffer, SIZE / 2);
+    queue.pop_n(buffer, SIZE / 2);
+    queue.push_n(buffer, SIZE);
+    other.push_n(buffer, SIZE / 2);
+
+    Measure("Queue", "copy_assign", typeName, SIZE, SIZE, [&]{
+        other = queue;
+        DoNotOptimize(other);
+    });
+
+    Measure("Queue", "swap", typeName, SIZE, SIZE, [&]{
+        queue.swap(other);
+        DoNotOptimize(queue);
+    });
+
+    Measure("Queue", "compare", typeName, SIZE, SIZE, [&]{
+        const bool equal = (queue == other);
+        DoNotOptimize(equal);
+    });
+
+    queue.consume(queue.size());
+    other.consume(other.size());
+}
+
+/**
+ * @brief   Stack throughput as well as copy, swap and assignment cost
+ */
+template<class T, std::size_t SIZE>
+void BenchmarkStack()
+{
+    static Stack<T, SIZE> stack, other;
+    const char* typeName = TypeName<T>();
+
+    Measure("Stack", "push_pop", typeName, SIZE, 2 * SIZE, [&]{
+        const T value(0x5A);
+
+        for(std::size_t index = 0; index < SIZE; ++index)
+            stack.push(value);
+
+        DoNotOptimize(stack);
+
+        while(!stack.empty())
+            stack.pop();
+    });
+
+    Measure("Stack", "emplace_pop", typeName, SIZE, 2 * SIZE, [&]{
+        for(std::size_t index = 0; index < SIZE; ++index)
+            stack.emplace(index);
+
+        DoNotOptimize(stack);
+
+        while(!stack.empty())
+            stack.pop();
+    });
+
+    for(std::size_t index = 0; index < SIZE; ++index)
+        stack.emplace(index);
+
+    for(std::size_t index = 0; index < SIZE / 2; ++index)
+        other.emplace(index);
+
+    Measure("Stack", "copy_assign", typeName, SIZE, SIZE, [&]{
+        other = stack;
+        DoNotOptimize(other);
+    });
+
+    Measure("Stack", "swap", typeName, SIZE, SIZE, [&]{
+        stack.swap(other);
+        DoNotOptimize(stack);
+    });
+
+    Measure("Stack", "compare", typeName, SIZE, SIZE, [&]{
+        const bool equal = (stack == other);
+        DoNotOptimize(equal);
+    });
+
+    while(!stack.empty())
+        stack.pop();
+
+    while(!other.empty())
+        other.pop();
+}
+
+/**
+ * @brief   Array fill and comparison bandwidth
+ */
+template<class T, std::size_t SIZE>
+void BenchmarkArray()
+{
+    static Array<T, SIZE> array, other;
+    const char* typeName = TypeName<T>();
+
+    Measure("Array", "fill_zero", typeName, SIZE, SIZE, [&]{
+        array.Fill(T(0));
+        DoNotOptimize(array);
+    });
+
+    Measure("Array", "fill_value", typeName, SIZE, SIZE, [&]{
+        array.Fill(T(0x5A));
+        DoNotOptimize(array);
+    });
+
+    other = array;
+
+    Measure("Array", "compare", typeName, SIZE, SIZE, [&]{
+        const bool equal = (array == other);
+        DoNotOptimize(equal);
+    });
+
+    Measure("Array", "copy_assign", typeName, SIZE, SIZE, [&]{
+        other = array;
+        DoNotOptimize(other);
+    });
+}
+
+/**
+ * @brief   Runs every benchmark for the given element type over the capacity matrix
+ * @note    Capacity 17 is there to compare the generic ring index against the power-of-two ones.
+ */
+template<class T>
+void BenchmarkType()
+{
+    BenchmarkQueue<T, 16>();
+    BenchmarkQueue<T, 17>();
+    BenchmarkQueue<T, 256>();
+
+    BenchmarkStack<T, 16>();
+    BenchmarkStack<T, 256>();
+
+    BenchmarkArray<T, 16>();
+    BenchmarkArray<T, 256>();
+    BenchmarkArray<T, 4096>();
+}
+
+} // namespace
+
+/**
+ * @brief   Runs the whole benchmark suite and prints the results
+ */
+void RunContainerBenchmarks()
+{
+    TickSource::Init();
+
+    std::printf("container,operation,type,capacity,operations,ticks,ticks_per_op,unit\n");
+
+    BenchmarkType<std::uint8_t>();
+    BenchmarkType<PodSample>();
+    BenchmarkType<NonTrivial>();
+}
+
+#ifndef BENCHMARK_NO_MAIN
+int main()
+{
+    RunContainerBenchmarks();
+
+    return 0;
+}
+#endif
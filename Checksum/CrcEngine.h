@@ -0,0 +1,359 @@
+/**
+ * @file        CrcEngine.h
+ * @details     A template streaming CRC engine for embedded systems.
+ *              Lookup tables are generated at compile time into Array containers and placed in read-only memory.
+ *              With slice-by-N tables, N input bytes are consumed per step with N independent table lookups,
+ *              instead of a dependent lookup per byte. Hardware CRC instructions are used where the target
+ *              provides them for the selected model.
+ *              Data is fed incrementally, e.g. from both contiguous segments of a Queue without copying.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ * @note        Example usage:
+ *              Crc<Crc32Model> crc;
+ *              crc.update(header).update(txQueue.segments());
+ *              const uint32_t checksum = crc.value();
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <cstdint>      // Fixed width integer types
+#include <type_traits>  // Compile time controls
+#include "../Containers/ArrayContainer.h"
+#include "../Containers/ContainerHelpers.h"
+#include "../Containers/Span.h"
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>   // __crc32b, __crc32w, __crc32cb, __crc32cw
+#include <cstring>      // std::memcpy
+#elif defined(__SSE4_2__)
+#include <nmmintrin.h>  // _mm_crc32_u8, _mm_crc32_u32
+#include <cstring>      // std::memcpy
+#endif
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** CRC Models ***/
+/**
+ * @tparam  CrcT        Register type, its width is the width of the CRC (8, 16 or 32 bits)
+ * @tparam  POLYNOMIAL  Generator polynomial in the normal (MSB first) notation
+ * @tparam  INITIAL     Initial register value
+ * @tparam  FINAL_XOR   Value XORed with the register to get the final CRC
+ * @tparam  REFLECTED   true if the bytes are processed LSB first (input and output reflection)
+ */
+template<class CrcT, CrcT POLYNOMIAL, CrcT INITIAL, CrcT FINAL_XOR, bool REFLECTED>
+struct CrcModel{
+    static_assert(std::is_unsigned_v<CrcT> && (sizeof(CrcT) <= 4), "CRC register must be an unsigned type of at most 32 bits!");
+
+    using value_type = CrcT;
+
+    static constexpr CrcT polynomial    = POLYNOMIAL;
+    static constexpr CrcT initial       = INITIAL;
+    static constexpr CrcT finalXor      = FINAL_XOR;
+    static constexpr bool reflected     = REFLECTED;
+};
+
+using Crc32Model        = CrcModel<std::uint32_t, 0x04C11DB7u, 0xFFFFFFFFu, 0xFFFFFFFFu, true>;     // CRC-32 (Ethernet, zlib, PNG)
+using Crc32cModel       = CrcModel<std::uint32_t, 0x1EDC6F41u, 0xFFFFFFFFu, 0xFFFFFFFFu, true>;     // CRC-32C (iSCSI, ext4)
+using Crc16CcittModel   = CrcModel<std::uint16_t, 0x1021u,     0xFFFFu,     0x0000u,     false>;    // CRC-16/CCITT-FALSE
+using Crc16ModbusModel  = CrcModel<std::uint16_t, 0x8005u,     0xFFFFu,     0x0000u,     true>;     // CRC-16/MODBUS
+using Crc8Model         = CrcModel<std::uint8_t,  0x07u,       0x00u,       0x00u,       false>;    // CRC-8/SMBUS
+
+/*** Hardware Policies ***/
+/**
+ * @brief   Table based computation only
+ * @note    A hardware policy updates the raw (not finalized) register of the models it accelerates.
+ */
+struct NoCrcHardware{
+    template<class ModelT>
+    static constexpr bool accelerates = false;
+
+    template<class ModelT>
+    static typename ModelT::value_type Update(typename ModelT::value_type crc, const std::uint8_t*, std::size_t) { return crc; }
+};
+
+#if defined(__ARM_FEATURE_CRC32) || defined(__SSE4_2__)
+/**
+ * @brief   CRC instructions of ARMv8 (CRC-32 and CRC-32C) and x86 SSE4.2 (CRC-32C only)
+ */
+struct InstructionCrcHardware{
+#if defined(__ARM_FEATURE_CRC32)
+    template<class ModelT>
+    static constexpr bool accelerates = std::is_same_v<ModelT, Crc32Model> || std::is_same_v<ModelT, Crc32cModel>;
+#else
+    template<class ModelT>
+    static constexpr bool accelerates = std::is_same_v<ModelT, Crc32cModel>;
+#endif
+
+    template<class ModelT>
+    static std::uint32_t Update(std::uint32_t crc, const std::uint8_t* data, std::size_t length)
+    {
+        for(; length >= 4; data += 4, length -= 4)
+        {
+            std::uint32_t word;
+            std::memcpy(&word, data, sizeof(word));     // Unaligned access, the instructions take little endian words
+            crc = Word<ModelT>(crc, word);
+        }
+
+        for(; 0 != length; ++data, --length)
+            crc = Byte<ModelT>(crc, *data);
+
+        return crc;
+    }
+
+private:
+    template<class ModelT>
+    static std::uint32_t Word(const std::uint32_t crc, const std::uint32_t word)
+    {
+#if defined(__ARM_FEATURE_CRC32)
+        if constexpr(std::is_same_v<ModelT, Crc32Model>)
+            return __crc32w(crc, word);
+        else
+            return __crc32cw(crc, word);
+#else
+        return _mm_crc32_u32(crc, word);
+#endif
+    }
+
+    template<class ModelT>
+    static std::uint32_t Byte(const std::uint32_t crc, const std::uint8_t byte)
+    {
+#if defined(__ARM_FEATURE_CRC32)
+        if constexpr(std::is_same_v<ModelT, Crc32Model>)
+            return __crc32b(crc, byte);
+        else
+            return __crc32cb(crc, byte);
+#else
+        return _mm_crc32_u8(crc, byte);
+#endif
+    }
+};
+
+using DefaultCrcHardware = InstructionCrcHardware;
+#else
+using DefaultCrcHardware = NoCrcHardware;
+#endif
+
+/*** Engine Class ***/
+/**
+ * @tparam  ModelT      CRC model, e.g. Crc32Model
+ * @tparam  SLICES      Bytes consumed per step, 1 for the classic byte-wise table (256 entries)
+ *                      Each slice costs another 256 entry table in read-only memory
+ * @tparam  HardwareT   Hardware policy, used instead of the tables for the models it accelerates
+ */
+template<class ModelT, std::size_t SLICES = 8, class HardwareT = DefaultCrcHardware>
+class Crc{
+public:
+    using value_type    = typename ModelT::value_type;
+    using size_type     = std::size_t;
+    using table_type    = Array<value_type, 256 * SLICES>;
+
+    static constexpr size_type WIDTH = 8 * sizeof(value_type);
+
+    static_assert((1 == SLICES) || (SLICES >= sizeof(value_type)), "Slice count must cover the CRC register!");
+
+    /*** Constructors ***/
+    constexpr Crc() noexcept : crc(ModelT::initial) { /* No operation */ }
+
+    /*** Modifiers ***/
+    constexpr Crc& update(const std::uint8_t* const data, const size_type length) noexcept;
+
+    Crc& update(const void* const data, const size_type length) noexcept
+    {
+        return update(static_cast<const std::uint8_t*>(data), length);
+    }
+
+    template<class T>
+    Crc& update(const Span<T>& span) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be checksummed!");
+
+        return update(static_cast<const void*>(span.data()), span.size_bytes());
+    }
+
+    template<class T>
+    Crc& update(const SpanPair<T>& segments) noexcept   // e.g. Queue::segments(), no intermediate copy
+    {
+        return update(segments.first).update(segments.second);
+    }
+
+    template<class T, std::size_t SIZE>
+    constexpr Crc& update(const Array<T, SIZE>& buffer) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be checksummed!");
+
+        if constexpr(std::is_same_v<T, std::uint8_t>)
+            return update(buffer.cbegin(), SIZE);
+        else
+            return update(static_cast<const void*>(buffer.cbegin()), buffer.sizeRaw());
+    }
+
+    constexpr void reset() noexcept { crc = ModelT::initial; }
+
+    /*** Results ***/
+    NODISCARD constexpr value_type value() const noexcept { return crc ^ ModelT::finalXor; }   // Final CRC of the data fed so far
+
+    NODISCARD static constexpr value_type Compute(const std::uint8_t* const data, const size_type length) noexcept
+    {
+        return Crc().update(data, length).value();
+    }
+
+    template<class T, std::size_t SIZE>
+    NODISCARD static constexpr value_type Compute(const Array<T, SIZE>& buffer) noexcept
+    {
+        return Crc().update(buffer).value();
+    }
+
+    // Slice tables, table[256 * k + i] is the register update of byte i followed by k zero bytes
+    static const table_type table;
+
+private:
+    /*** Members ***/
+    value_type crc;     // Raw register
+
+    /*** Helper functions ***/
+    static constexpr table_type MakeTable();
+
+    static constexpr value_type TopBit() { return static_cast<value_type>(value_type(1) << (WIDTH - 1)); }
+
+    static constexpr value_type ReflectedPolynomial()
+    {
+        value_type reflectedPoly = 0;
+
+        for(size_type bit = 0; bit < WIDTH; ++bit)
+        {
+            if(ModelT::polynomial & (value_type(1) << bit))
+                reflectedPoly |= static_cast<value_type>(value_type(1) << (WIDTH - 1 - bit));
+        }
+
+        return reflectedPoly;
+    }
+
+    // Register byte that meets the next input byte
+    static constexpr std::uint8_t LeadingByte(const value_type reg, const size_type byteIdx)
+    {
+        if constexpr(ModelT::reflected)
+            return static_cast<std::uint8_t>(reg >> (8 * byteIdx));
+        else
+            return static_cast<std::uint8_t>(reg >> (WIDTH - 8 - (8 * byteIdx)));
+    }
+
+    // Shifts the register by a single byte through the first table
+    static constexpr value_type Advance(const value_type reg, const table_type& slices)
+    {
+        if constexpr(1 == sizeof(value_type))
+            return slices[reg];
+        else if constexpr(ModelT::reflected)
+            return static_cast<value_type>((reg >> 8) ^ slices[reg & 0xFFu]);
+        else
+            return static_cast<value_type>((reg << 8) ^ slices[LeadingByte(reg, 0)]);
+    }
+};
+
+/**
+ * @brief   Slice tables, generated at compile time into read-only memory
+ */
+template<class ModelT, std::size_t SLICES, class HardwareT>
+inline constexpr typename Crc<ModelT, SLICES, HardwareT>::table_type Crc<ModelT, SLICES, HardwareT>::table = Crc<ModelT, SLICES, HardwareT>::MakeTable();
+
+/**
+ * @brief   Generates the slice tables
+ * @return  Table of the first slice followed by the tables of the further slices
+ * @note    The first slice is the classic byte-wise table. Each further slice advances
+ *          the entries of the previous one by a zero byte.
+ */
+template<class ModelT, std::size_t SLICES, class HardwareT>
+constexpr typename Crc<ModelT, SLICES, HardwareT>::table_type Crc<ModelT, SLICES, HardwareT>::MakeTable()
+{
+    table_type generated(0);
+
+    for(size_type index = 0; index < 256; ++index)
+    {
+        value_type reg = 0;
+
+        if constexpr(ModelT::reflected)
+        {
+            reg = static_cast<value_type>(index);
+
+            for(int bit = 0; bit < 8; ++bit)
+                reg = static_cast<value_type>((reg & 1u) ? ((reg >> 1) ^ ReflectedPolynomial()) : (reg >> 1));
+        }
+        else
+        {
+            reg = static_cast<value_type>(index << (WIDTH - 8));
+
+            for(int bit = 0; bit < 8; ++bit)
+                reg = static_cast<value_type>((reg & TopBit()) ? ((reg << 1) ^ ModelT::polynomial) : (reg << 1));
+        }
+
+        generated[index] = reg;
+    }
+
+    for(size_type index = 256; index < generated.size(); ++index)
+        generated[index] = Advance(generated[index - 256], generated);
+
+    return generated;
+}
+
+/**
+ * @brief   Feeds the bytes into the CRC register
+ * @param   data    First byte
+ * @param   length  Number of bytes
+ * @return  lValue reference to the engine to support cascaded calls.
+ * @note    Bytes are consumed SLICES at a time. The register is folded into the first bytes of
+ *          each step and every byte is looked up in the table of its distance to the step end.
+ */
+template<class ModelT, std::size_t SLICES, class HardwareT>
+constexpr Crc<ModelT, SLICES, HardwareT>& Crc<ModelT, SLICES, HardwareT>::update(const std::uint8_t* data, size_type length) noexcept
+{
+    if constexpr(HardwareT::template accelerates<ModelT>)
+    {
+        if(!ContainerDetail::IsConstantEvaluated())
+        {
+            crc = HardwareT::template Update<ModelT>(crc, data, length);
+
+            return *this;
+        }
+    }
+
+    if constexpr(1 < SLICES)
+    {
+        for(; length >= SLICES; data += SLICES, length -= SLICES)
+        {
+            value_type next = 0;
+
+            for(size_type byteIdx = 0; byteIdx < SLICES; ++byteIdx)
+            {
+                std::uint8_t byte = data[byteIdx];
+
+                if(byteIdx < sizeof(value_type))
+                    byte ^= LeadingByte(crc, byteIdx);
+
+                next ^= table[(256 * (SLICES - 1 - byteIdx)) + byte];
+            }
+
+            crc = next;
+        }
+    }
+
+    for(; 0 != length; ++data, --length)
+    {
+        if constexpr(ModelT::reflected)
+            crc = static_cast<value_type>((crc >> 8) ^ table[static_cast<std::uint8_t>(crc ^ *data)]);
+        else
+            crc = static_cast<value_type>((crc << 8) ^ table[static_cast<std::uint8_t>(LeadingByte(crc, 0) ^ *data)]);
+    }
+
+    return *this;
+}
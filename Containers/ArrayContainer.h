@@ -15,6 +15,12 @@
  *              March 23, 2021 -> Type traits added to related functions.
  *                             -> Standard named requirements added to class.
  *              March 26, 2021 -> Exception safety condition changed for assignments and swapping.
+ *              October 14, 2026 -> Constructors, element access, comparison and fill operations made constexpr.
+ *                               -> Inverted range assertion in at(..) fixed.
+ *                               -> memset based fill and memcmp based comparison for arithmetic types.
+ *                               -> memcpy based copy for the same trivially copyable types.
+ *                               -> Iterator range constructor added.
+ *                               -> footprint_bytes() added for memory budgets.
  *
  *  @note       Feel free to contact for questions, bugs, improvements or any other thing.
  *  @copyright  No copyright.
@@ -29,6 +35,9 @@
 #include <initializer_list>         // For initializer_list constructor
 #include <type_traits>              // For compile time controls
 #include <cassert>                  // For assertions
+#include <cstring>                  // For std::memcmp, std::memcpy
+#include <iterator>                 // For iterator range constructor
+#include "ContainerHelpers.h"       // For bulk fill helpers
 
 /** Special definitions **/
 #if __cplusplus >= 201703l          // If the C++ version is greater or equal to 2017xx
@@ -58,66 +67,77 @@ public:
     Array() noexcept(std::is_nothrow_constructible<T>::value) = default;    // Default constructor
 
     template<class U>    // Fill constructor
-    Array(const U& fillValue) noexcept(std::is_nothrow_assignable_v<T&, U>);
+    constexpr Array(const U& fillValue) noexcept(std::is_nothrow_assignable_v<T&, U>);
 
     template<class U, std::size_t uSIZE>    // Converting constructor
-    Array(const Array<U, uSIZE>& copyArr) noexcept(std::is_nothrow_assignable_v<T&, U>);
+    constexpr Array(const Array<U, uSIZE>& copyArr) noexcept(std::is_nothrow_assignable_v<T&, U>);
 
     template<class U>   // Construct with C-Style array of any type
-    Array(const U* const source, const size_type size) noexcept(std::is_nothrow_assignable_v<T&, U>);
+    constexpr Array(const U* const source, const size_type size) noexcept(std::is_nothrow_assignable_v<T&, U>);
 
     template<class U>   // Initializer_list constructor
-    Array(std::initializer_list<U> initializerList) noexcept(std::is_nothrow_assignable_v<T&, U>);
+    constexpr Array(std::initializer_list<U> initializerList) noexcept(std::is_nothrow_assignable_v<T&, U>);
+
+    template<class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>   // Iterator range constructor
+    constexpr Array(InputIt first, InputIt last) noexcept(std::is_nothrow_assignable_v<T&, typename std::iterator_traits<InputIt>::reference>);
 
     ~Array() = default;
 
     /*** Element Access ***/
-    NODISCARD iterator begin() noexcept                 { return data;          }
-    NODISCARD const_iterator begin() const noexcept     { return data;          }
-    NODISCARD iterator end() noexcept                   { return data + SIZE;   }
-    NODISCARD const_iterator end() const noexcept       { return data + SIZE;   }
+    NODISCARD constexpr iterator begin() noexcept               { return data;          }
+    NODISCARD constexpr const_iterator begin() const noexcept   { return data;          }
+    NODISCARD constexpr iterator end() noexcept                 { return data + SIZE;   }
+    NODISCARD constexpr const_iterator end() const noexcept     { return data + SIZE;   }
 
-    NODISCARD const_iterator cbegin() const noexcept    { return data;          }
-    NODISCARD const_iterator cend() const noexcept      { return data + SIZE;   }
+    NODISCARD constexpr const_iterator cbegin() const noexcept  { return data;          }
+    NODISCARD constexpr const_iterator cend() const noexcept    { return data + SIZE;   }
 
-    NODISCARD reference at(const size_type position)                { assert(position >= SIZE); return data[position]; }
-    NODISCARD const_reference at(const size_type position) const    { assert(position >= SIZE); return data[position]; }
+    NODISCARD constexpr reference at(const size_type position)              { assert(position < SIZE); return data[position]; }
+    NODISCARD constexpr const_reference at(const size_type position) const  { assert(position < SIZE); return data[position]; }
 
     /*** Operators ***/
-    NODISCARD const_reference operator[](const size_type index) const     { return data[index]; }    // Subscript for non-assignable reference
-    NODISCARD reference operator[](const size_type index)                 { return data[index]; }    // Subscript for assignable reference
+    NODISCARD constexpr const_reference operator[](const size_type index) const   { return data[index]; }    // Subscript for non-assignable reference
+    NODISCARD constexpr reference operator[](const size_type index)               { return data[index]; }    // Subscript for assignable reference
 
     template<class U>    // Compare any kind of arrays
-    NODISCARD bool operator==(const Array<U, SIZE>& rightArr) const noexcept;
+    NODISCARD constexpr bool operator==(const Array<U, SIZE>& rightArr) const noexcept;
     template<class U>    // Compare any kind of arrays by unequality
-    NODISCARD bool operator!=(const Array<U, SIZE>& rightArr) const noexcept;
+    NODISCARD constexpr bool operator!=(const Array<U, SIZE>& rightArr) const noexcept;
 
     template<class U, size_type uSIZE>    // Copy assignment operator
-    Array& operator=(const Array<U, uSIZE>& copyArr) noexcept(std::is_nothrow_assignable_v<T&, U>);
+    constexpr Array& operator=(const Array<U, uSIZE>& copyArr) noexcept(std::is_nothrow_assignable_v<T&, U>);
 
     /*** Operations ***/
     Array& Swap(Array& swapArr) noexcept(std::is_nothrow_swappable_v<T>);
 
     template<class U>
-    Array& Fill(const U& fillValue) noexcept(std::is_nothrow_assignable_v<T&, U>);
+    constexpr Array& Fill(const U& fillValue) noexcept(std::is_nothrow_assignable_v<T&, U>);
 
     template<class U>
-    Array& Fill(const U& fillValue, const size_type startPos, const size_type endPos = SIZE) noexcept(std::is_nothrow_assignable_v<T&, U>);
+    constexpr Array& Fill(const U& fillValue, const size_type startPos, const size_type endPos = SIZE) noexcept(std::is_nothrow_assignable_v<T&, U>);
 
     template<class U>
-    Array& Fill(const U& fillValue, iterator startPos, iterator endPos) noexcept(std::is_nothrow_assignable_v<T&, U>);
+    constexpr Array& Fill(const U& fillValue, iterator startPos, iterator endPos) noexcept(std::is_nothrow_assignable_v<T&, U>);
 
     template<class RuleT>
-    Array& FillWithRule(const RuleT& predicate);
+    constexpr Array& FillWithRule(const RuleT& predicate);
 
     /*** Status Checkers ***/
     NODISCARD constexpr size_type max_size() const noexcept         { return SIZE;              }    // Return the maximum possible size
     NODISCARD constexpr size_type size() const noexcept             { return SIZE;              }    // Returns total number of elements
     NODISCARD constexpr size_type sizeRaw() const noexcept          { return SIZE * sizeof(T);  }    // Return actual size in bytes
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(Array); } // Memory taken by an instance, including bookkeeping and padding
     NODISCARD constexpr bool empty() const noexcept                 { return (SIZE == 0);       }
 
 private:
     value_type data[SIZE];
+
+    /*** Helper Functions ***/
+    template<class U>
+    constexpr void FillRange(const U& fillValue, const size_type startPos, const size_type endPos);
+
+    template<class InputIt>
+    constexpr void CopyRange(InputIt source, const size_type count);
 };
 
 /**
@@ -126,10 +146,10 @@ private:
  */
 template<class T, std::size_t SIZE>
 template<class U>
-Array<T, SIZE>::Array(const U& fillValue) noexcept(std::is_nothrow_assignable_v<T&, U>)
+constexpr Array<T, SIZE>::Array(const U& fillValue) noexcept(std::is_nothrow_assignable_v<T&, U>)
+    : data()
 {
-    for(reference element : *this)
-        element = fillValue;
+    FillRange(fillValue, 0, SIZE);
 }
 
 /**
@@ -137,23 +157,17 @@ Array<T, SIZE>::Array(const U& fillValue) noexcept(std::is_nothrow_assignable_v<
  * @param   copyArr    Source array
  * @note    The source array can be of different type and size
  * @note    Copy size is determined as the lower one of size attributes
+ * @note    Elements without a source counterpart are value-initialized
  *
  * @attention Unintentional data loss may occur as the types and sizes might not be the same.
  *            It is the user's responsibility to consider etiher data or precision loss.
  */
 template<class T, std::size_t SIZE>
 template<class U, std::size_t uSIZE>
-Array<T, SIZE>::Array(const Array<U, uSIZE>& copyArr) noexcept(std::is_nothrow_assignable_v<T&, U>)
+constexpr Array<T, SIZE>::Array(const Array<U, uSIZE>& copyArr) noexcept(std::is_nothrow_assignable_v<T&, U>)
+    : data()
 {
-    typename Array<U, uSIZE>::const_iterator it = copyArr.cbegin();
-
-    for(reference element : *this)
-    {
-        element = *it;
-
-        if(++it == copyArr.cend())
-            break;
-    }
+    CopyRange(copyArr.cbegin(), (uSIZE < SIZE) ? uSIZE : SIZE);
 }
 
 /**
@@ -161,27 +175,57 @@ Array<T, SIZE>::Array(const Array<U, uSIZE>& copyArr) noexcept(std::is_nothrow_a
  * @param   source        Source buffer
  * @param   sourceSize    Number of elements in the source
  * @note    In case of an inequality between size values, the lower one is chosen
+ * @note    Elements without a source counterpart are value-initialized
  * @note    noexcept exception specifier is not used due to the possibility
  *          of wrong sourceSize inputs.
  */
 template<class T, std::size_t SIZE>
 template<class U>
-Array<T, SIZE>::Array(const U* const source, const size_type sourceSize) noexcept(std::is_nothrow_assignable_v<T&, U>)
+constexpr Array<T, SIZE>::Array(const U* const source, const size_type sourceSize) noexcept(std::is_nothrow_assignable_v<T&, U>)
+    : data()
 {
     if(source != nullptr)
+        CopyRange(source, (sourceSize < SIZE) ? sourceSize : SIZE);
+}
+
+/**
+ * @brief   Constructs the array with the elements in the given iterator range
+ * @param   first   Iterator to the first element to be copied
+ * @param   last    Iterator after the last element to be copied
+ * @note    In case of an inequality between size values, the lower one is chosen
+ * @note    Elements without a source counterpart are value-initialized
+ * @note    Contiguous sources like Queue, Stack or Span segments can be copied without any temporary.
+ */
+template<class T, std::size_t SIZE>
+template<class InputIt, class>
+constexpr Array<T, SIZE>::Array(InputIt first, InputIt last) noexcept(std::is_nothrow_assignable_v<T&, typename std::iterator_traits<InputIt>::reference>)
+    : data()
+{
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+
+    if constexpr(std::is_base_of_v<std::random_access_iterator_tag, category>)
     {
-        for(size_type index = 0; (index < SIZE) && (index < sourceSize); ++ index)
-            data[index] = source[index];
+        const difference_type count = last - first;
+
+        if(count > 0)
+            CopyRange(first, (static_cast<size_type>(count) < SIZE) ? static_cast<size_type>(count) : SIZE);
+    }
+    else
+    {
+        for(size_type index = 0; (index < SIZE) && (first != last); ++index, ++first)
+            data[index] = *first;
     }
 }
 
 /**
  * @brief   Constructs the array with brace-enclosed initializer list.
  * @param   initializerList    Source list
+ * @note    Elements without a source counterpart are value-initialized
  */
 template<class T, std::size_t SIZE>
 template<class U>
-Array<T, SIZE>::Array(std::initializer_list<U> initializerList) noexcept(std::is_nothrow_assignable_v<T&, U>)
+constexpr Array<T, SIZE>::Array(std::initializer_list<U> initializerList) noexcept(std::is_nothrow_assignable_v<T&, U>)
+    : data()
 {
     size_type index = 0;
     for(const U& element : initializerList)
@@ -202,11 +246,21 @@ Array<T, SIZE>::Array(std::initializer_list<U> initializerList) noexcept(std::is
  */
 template<class T, std::size_t SIZE>
 template<class U>
-NODISCARD bool Array<T, SIZE>::operator==(const Array<U, SIZE>& rightArr) const noexcept
+NODISCARD constexpr bool Array<T, SIZE>::operator==(const Array<U, SIZE>& rightArr) const noexcept
 {
     if(static_cast<const void*>(this) == static_cast<const void*>(&rightArr))    // Self comparison
         return true;
 
+    /* Integral types have unique object representations, hence the same typed
+     * arrays can be compared bytewise. The library memcmp is word-wide or vectorized
+     * and stops at the first mismatching block. Floating point types are excluded
+     * as NaN compares unequal to itself and +0.0 compares equal to -0.0. */
+    if constexpr(std::is_same_v<T, U> && std::is_integral_v<T>)
+    {
+        if(!ContainerDetail::IsConstantEvaluated())
+            return (0 == std::memcmp(data, rightArr.cbegin(), sizeRaw()));
+    }
+
     typename Array<U, SIZE>::const_iterator itRight = rightArr.cbegin();
 
     /* Comparing with std::memcmp is not eligible because although the size of
@@ -232,7 +286,7 @@ NODISCARD bool Array<T, SIZE>::operator==(const Array<U, SIZE>& rightArr) const
  */
 template<class T, std::size_t SIZE>
 template<class U>
-NODISCARD bool Array<T, SIZE>::operator!=(const Array<U, SIZE>& rightArr) const noexcept
+NODISCARD constexpr bool Array<T, SIZE>::operator!=(const Array<U, SIZE>& rightArr) const noexcept
 {
     return !(this->operator==(rightArr));
 }
@@ -244,20 +298,12 @@ NODISCARD bool Array<T, SIZE>::operator!=(const Array<U, SIZE>& rightArr) const
  */
 template<class T, std::size_t SIZE>
 template<class U, std::size_t uSIZE>
-Array<T, SIZE>& Array<T, SIZE>::operator=(const Array<U, uSIZE>& copyArr) noexcept(std::is_nothrow_assignable_v<T&, U>)
+constexpr Array<T, SIZE>& Array<T, SIZE>::operator=(const Array<U, uSIZE>& copyArr) noexcept(std::is_nothrow_assignable_v<T&, U>)
 {
     if(static_cast<const void*>(this) == static_cast<const void*>(&copyArr))    // Check self copy
         return *this;
 
-    typename Array<U, SIZE>::const_iterator itRight = copyArr.cbegin();
-
-    for(reference element : *this)
-    {
-        element = *itRight;
-
-        if(++itRight == copyArr.cend())
-            break;
-    }
+    CopyRange(copyArr.cbegin(), (uSIZE < SIZE) ? uSIZE : SIZE);
 
     return *this;
 }
@@ -293,10 +339,9 @@ Array<T, SIZE>& Array<T, SIZE>::Swap(Array<T, SIZE>& swapArr) noexcept(std::is_n
  */
 template<class T, std::size_t SIZE>
 template<class U>
-Array<T, SIZE>& Array<T, SIZE>::Fill(const U& fillValue) noexcept(std::is_nothrow_assignable_v<T&, U>)
+constexpr Array<T, SIZE>& Array<T, SIZE>::Fill(const U& fillValue) noexcept(std::is_nothrow_assignable_v<T&, U>)
 {
-    for(reference element : *this)
-        element = fillValue;
+    FillRange(fillValue, 0, SIZE);
 
     return *this;
 }
@@ -310,10 +355,10 @@ Array<T, SIZE>& Array<T, SIZE>::Fill(const U& fillValue) noexcept(std::is_nothro
  */
 template<class T, std::size_t SIZE>
 template<class U>
-Array<T, SIZE>& Array<T, SIZE>::Fill(const U& fillValue, const size_type startPos, const size_type endPos) noexcept(std::is_nothrow_assignable_v<T&, U>)
+constexpr Array<T, SIZE>& Array<T, SIZE>::Fill(const U& fillValue, const size_type startPos, const size_type endPos) noexcept(std::is_nothrow_assignable_v<T&, U>)
 {
-    for(size_type index = startPos; (index < SIZE) && (index < endPos); ++index)
-        data[index] = fillValue;
+    if((startPos < SIZE) && (startPos < endPos))
+        FillRange(fillValue, startPos, (endPos < SIZE) ? endPos : SIZE);
 
     return *this;
 }
@@ -327,7 +372,7 @@ Array<T, SIZE>& Array<T, SIZE>::Fill(const U& fillValue, const size_type startPo
  */
 template<class T, std::size_t SIZE>
 template<class U>
-Array<T, SIZE>& Array<T, SIZE>::Fill(const U& fillValue, iterator startPos, iterator endPos) noexcept(std::is_nothrow_assignable_v<T&, U>)
+constexpr Array<T, SIZE>& Array<T, SIZE>::Fill(const U& fillValue, iterator startPos, iterator endPos) noexcept(std::is_nothrow_assignable_v<T&, U>)
 {
     if((startPos < begin()) || (startPos >= end()))    // Manual address input might violate the address range
         return *this;
@@ -335,8 +380,7 @@ Array<T, SIZE>& Array<T, SIZE>::Fill(const U& fillValue, iterator startPos, iter
     if(startPos >= endPos)
         return *this;
 
-    for(iterator it = startPos; (it < end()) && (it < endPos); ++it)
-        *it = fillValue;
+    FillRange(fillValue, static_cast<size_type>(startPos - begin()), static_cast<size_type>(((endPos < end()) ? endPos : end()) - begin()));
 
     return *this;
 }
@@ -351,10 +395,13 @@ Array<T, SIZE>& Array<T, SIZE>::Fill(const U& fillValue, iterator startPos, iter
  *
  * @note    For more examples, refer to:
  *          github.com/CaglayanDokme/CPP-Exercises/blob/main/FuncWithLambdaArg.cpp
+ *
+ * @note    Lookup tables can be generated at compile time and placed in read-only memory:
+ *          constexpr auto table = Array<uint16_t, 256>(0).FillWithRule([](const std::size_t pos) {return pos * 3;});
  */
 template<class T, std::size_t SIZE>
 template<class RuleT>
-Array<T, SIZE>& Array<T, SIZE>::FillWithRule(const RuleT& predicate)
+constexpr Array<T, SIZE>& Array<T, SIZE>::FillWithRule(const RuleT& predicate)
 {
     for(size_type index = 0; index < SIZE; ++index)
         data[index] = predicate(index);
@@ -362,4 +409,58 @@ Array<T, SIZE>& Array<T, SIZE>::FillWithRule(const RuleT& predicate)
     return *this;
 }
 
+/**
+ * @brief   Fills the elements in the given position range
+ * @param   fillValue   Reference fill value
+ * @param   startPos    Start position for filling
+ * @param   endPos      End position for filling(excluded), must not exceed the size
+ * @note    Arithmetic types are filled with memset when the value is a repeated byte pattern.
+ *          Other values are filled with a plain loop which is suitable for auto-vectorization.
+ */
+template<class T, std::size_t SIZE>
+template<class U>
+constexpr void Array<T, SIZE>::FillRange(const U& fillValue, const size_type startPos, const size_type endPos)
+{
+    if constexpr(std::is_arithmetic_v<T> && std::is_arithmetic_v<U>)
+    {
+        const value_type value = fillValue;     // Convert only once
+
+        if(!ContainerDetail::IsConstantEvaluated() && ContainerDetail::FillBytes(data + startPos, endPos - startPos, value))
+            return;
+
+        for(size_type index = startPos; index < endPos; ++index)
+            data[index] = value;
+    }
+    else
+    {
+        for(size_type index = startPos; index < endPos; ++index)
+            data[index] = fillValue;
+    }
+}
+
+/**
+ * @brief   Copies elements to the beginning of the array
+ * @param   source  Iterator to the first element to be copied
+ * @param   count   Number of elements to be copied, must not exceed the size
+ * @note    A single memcpy is used if the source has the same trivially copyable type.
+ */
+template<class T, std::size_t SIZE>
+template<class InputIt>
+constexpr void Array<T, SIZE>::CopyRange(InputIt source, const size_type count)
+{
+    if constexpr(ContainerDetail::IsMemcpyable<T, InputIt>)
+    {
+        if(!ContainerDetail::IsConstantEvaluated())
+        {
+            if(0 != count)
+                std::memcpy(data, source, count * sizeof(T));
+
+            return;
+        }
+    }
+
+    for(size_type index = 0; index < count; ++index, ++source)
+        data[index] = *source;
+}
+
 #endif // Recursive inclusion preventer
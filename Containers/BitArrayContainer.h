@@ -0,0 +1,384 @@
+/**
+ * @file        BitArrayContainer.h
+ * @details     A template fixed-size bit array for embedded systems.
+ *              Bits are packed into 32-bit words, so the array takes 8 times less memory than Array<bool, SIZE>.
+ *              Fill, comparison and bitwise operations work a whole word at a time. Population count and
+ *              bit scans are done with the CLZ/CTZ/POPCNT instructions of the target where available.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> footprint_bytes() added for memory budgets.
+ *
+ * @note        This is a separate container instead of an Array<bool, SIZE> specialization.
+ *              A specialization could not hand out bool& and would silently change the meaning of
+ *              existing code, the way std::vector<bool> does.
+ * @note        The unused bits of the last word are always kept cleared, so word level
+ *              comparison and counting need no masking.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t
+#include <cassert>      // assert
+#include "ContainerHelpers.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+template<std::size_t SIZE>
+class BitArray{
+    static_assert(SIZE != 0, "BitArray size cannot be zero!");
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type        = bool;
+    using size_type         = std::size_t;
+    using difference_type   = std::ptrdiff_t;
+    using const_reference   = bool;
+    using word_type         = std::uint32_t;
+
+    static constexpr size_type WORD_BITS    = 32;
+    static constexpr size_type WORD_COUNT   = (SIZE + WORD_BITS - 1) / WORD_BITS;
+    static constexpr size_type npos         = SIZE;     // Returned by the bit scans if no bit is found
+
+    // Assignable proxy for a single bit
+    class reference{
+    public:
+        constexpr reference& operator=(const bool value) noexcept
+        {
+            word = value ? (word | mask) : (word & ~mask);
+
+            return *this;
+        }
+
+        constexpr reference& operator=(const reference& other) noexcept { return (*this = static_cast<bool>(other)); }
+        constexpr operator bool() const noexcept                        { return (0 != (word & mask));             }
+        constexpr reference& flip() noexcept                            { word ^= mask; return *this;              }
+
+    private:
+        friend class BitArray;
+
+        constexpr reference(word_type& bitWord, const word_type bitMask) noexcept : word(bitWord), mask(bitMask) { /* No operation */ }
+
+        word_type&      word;
+        const word_type mask;
+    };
+
+    /*** Constructors and Destructors ***/
+    constexpr BitArray() noexcept : words{} { /* No operation */ }                      // All bits cleared
+    constexpr explicit BitArray(const bool fillValue) noexcept : words{} { Fill(fillValue); }   // Fill constructor
+
+    /*** Element Access ***/
+    NODISCARD constexpr bool test(const size_type position) const noexcept  { return (0 != (words[WordIndex(position)] & BitMask(position))); }
+    NODISCARD constexpr bool at(const size_type position) const             { assert(position < SIZE); return test(position);               }
+    NODISCARD constexpr reference at(const size_type position)              { assert(position < SIZE); return (*this)[position];            }
+
+    NODISCARD constexpr const word_type* data() const noexcept              { return words;                                                  }    // Underlying words, least significant bit first
+    NODISCARD constexpr word_type word(const size_type wordIdx) const       { return words[wordIdx];                                         }
+
+    /*** Modifiers ***/
+    constexpr BitArray& set(const size_type position, const bool value = true) noexcept
+    {
+        (*this)[position] = value;
+
+        return *this;
+    }
+
+    constexpr BitArray& reset(const size_type position) noexcept    { words[WordIndex(position)] &= ~BitMask(position); return *this; }
+    constexpr BitArray& flip(const size_type position) noexcept     { words[WordIndex(position)] ^=  BitMask(position); return *this; }
+    constexpr BitArray& Flip() noexcept;
+
+    /*** Operators ***/
+    NODISCARD constexpr bool      operator[](const size_type index) const noexcept  { return test(index);                                          }
+    NODISCARD constexpr reference operator[](const size_type index) noexcept        { return reference(words[WordIndex(index)], BitMask(index));   }
+
+    NODISCARD constexpr bool operator==(const BitArray& rightArr) const noexcept;
+    NODISCARD constexpr bool operator!=(const BitArray& rightArr) const noexcept    { return !(*this == rightArr); }
+
+    constexpr BitArray& operator&=(const BitArray& rightArr) noexcept;
+    constexpr BitArray& operator|=(const BitArray& rightArr) noexcept;
+    constexpr BitArray& operator^=(const BitArray& rightArr) noexcept;
+
+    NODISCARD constexpr BitArray operator~() const noexcept                         { return BitArray(*this).Flip();     }
+    NODISCARD constexpr BitArray operator&(const BitArray& rightArr) const noexcept { return BitArray(*this) &= rightArr; }
+    NODISCARD constexpr BitArray operator|(const BitArray& rightArr) const noexcept { return BitArray(*this) |= rightArr; }
+    NODISCARD constexpr BitArray operator^(const BitArray& rightArr) const noexcept { return BitArray(*this) ^= rightArr; }
+
+    /*** Operations ***/
+    constexpr BitArray& Fill(const bool fillValue) noexcept;
+    constexpr BitArray& Fill(const bool fillValue, const size_type startPos, const size_type endPos = SIZE) noexcept;
+
+    template<class RuleT>
+    constexpr BitArray& FillWithRule(const RuleT& predicate);
+
+    /*** Queries ***/
+    NODISCARD constexpr size_type count() const noexcept;
+    NODISCARD constexpr bool      any() const noexcept;
+    NODISCARD constexpr bool      none() const noexcept     { return !any();            }
+    NODISCARD constexpr bool      all() const noexcept      { return (SIZE == count()); }
+    NODISCARD constexpr size_type find_first() const noexcept                       { return find_next(0); }
+    NODISCARD constexpr size_type find_next(const size_type position) const noexcept;
+    NODISCARD constexpr size_type find_last() const noexcept;
+
+    /*** Status Checkers ***/
+    NODISCARD constexpr size_type max_size() const noexcept   { return SIZE;                          }    // Return the maximum possible size
+    NODISCARD constexpr size_type size() const noexcept       { return SIZE;                          }    // Returns total number of bits
+    NODISCARD constexpr size_type sizeRaw() const noexcept    { return WORD_COUNT * sizeof(word_type); }   // Return actual size in bytes
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(BitArray); } // Memory taken by an instance, including bookkeeping and padding
+    NODISCARD constexpr bool empty() const noexcept           { return false;                         }
+
+private:
+    word_type words[WORD_COUNT];
+
+    // Valid bits of the last word
+    static constexpr word_type LAST_WORD_MASK = (0 == (SIZE % WORD_BITS)) ? ~word_type(0) : ((word_type(1) << (SIZE % WORD_BITS)) - 1);
+
+    /*** Helper Functions ***/
+    static constexpr size_type WordIndex(const size_type position)  { return position / WORD_BITS;                            }
+    static constexpr word_type BitMask(const size_type position)    { return word_type(1) << (position % WORD_BITS);          }
+
+    constexpr void Apply(const size_type wordIdx, const word_type mask, const bool value)
+    {
+        words[wordIdx] = value ? (words[wordIdx] | mask) : (words[wordIdx] & ~mask);
+    }
+};
+
+/**
+ * @brief   Inverts every bit of the array
+ * @return  lValue reference to the array to support cascaded calls.
+ */
+template<std::size_t SIZE>
+constexpr BitArray<SIZE>& BitArray<SIZE>::Flip() noexcept
+{
+    for(word_type& bitWord : words)
+        bitWord = ~bitWord;
+
+    words[WORD_COUNT - 1] &= LAST_WORD_MASK;
+
+    return *this;
+}
+
+/**
+ * @brief   Compares two bit arrays word by word
+ * @param   rightArr    Bit array to be compared with
+ * @return  true        If all bits are equal
+ */
+template<std::size_t SIZE>
+constexpr bool BitArray<SIZE>::operator==(const BitArray& rightArr) const noexcept
+{
+    for(size_type wordIdx = 0; wordIdx < WORD_COUNT; ++wordIdx)
+    {
+        if(words[wordIdx] != rightArr.words[wordIdx])
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Bitwise AND assignment
+ * @param   rightArr    Right hand side operand
+ * @return  lValue reference to the left array to support cascaded calls.
+ */
+template<std::size_t SIZE>
+constexpr BitArray<SIZE>& BitArray<SIZE>::operator&=(const BitArray& rightArr) noexcept
+{
+    for(size_type wordIdx = 0; wordIdx < WORD_COUNT; ++wordIdx)
+        words[wordIdx] &= rightArr.words[wordIdx];
+
+    return *this;
+}
+
+/**
+ * @brief   Bitwise OR assignment
+ * @param   rightArr    Right hand side operand
+ * @return  lValue reference to the left array to support cascaded calls.
+ */
+template<std::size_t SIZE>
+constexpr BitArray<SIZE>& BitArray<SIZE>::operator|=(const BitArray& rightArr) noexcept
+{
+    for(size_type wordIdx = 0; wordIdx < WORD_COUNT; ++wordIdx)
+        words[wordIdx] |= rightArr.words[wordIdx];
+
+    return *this;
+}
+
+/**
+ * @brief   Bitwise XOR assignment
+ * @param   rightArr    Right hand side operand
+ * @return  lValue reference to the left array to support cascaded calls.
+ */
+template<std::size_t SIZE>
+constexpr BitArray<SIZE>& BitArray<SIZE>::operator^=(const BitArray& rightArr) noexcept
+{
+    for(size_type wordIdx = 0; wordIdx < WORD_COUNT; ++wordIdx)
+        words[wordIdx] ^= rightArr.words[wordIdx];
+
+    return *this;
+}
+
+/**
+ * @brief   Sets or clears every bit of the array
+ * @param   fillValue   Value of the bits
+ * @return  lValue reference to the array to support cascaded calls.
+ */
+template<std::size_t SIZE>
+constexpr BitArray<SIZE>& BitArray<SIZE>::Fill(const bool fillValue) noexcept
+{
+    const word_type fillWord = fillValue ? ~word_type(0) : word_type(0);
+
+    for(word_type& bitWord : words)
+        bitWord = fillWord;
+
+    words[WORD_COUNT - 1] &= LAST_WORD_MASK;
+
+    return *this;
+}
+
+/**
+ * @brief   Sets or clears a sub-range of the array
+ * @param   fillValue   Value of the bits
+ * @param   startPos    Start position for filling
+ * @param   endPos      End position for filling(excluded)
+ * @return  lValue reference to the array to support cascaded calls.
+ * @note    Only the boundary words are masked, the words in between are written as a whole.
+ */
+template<std::size_t SIZE>
+constexpr BitArray<SIZE>& BitArray<SIZE>::Fill(const bool fillValue, const size_type startPos, const size_type endPos) noexcept
+{
+    if((startPos >= SIZE) || (startPos >= endPos))
+        return *this;
+
+    const size_type lastPos     = ((endPos < SIZE) ? endPos : SIZE) - 1;
+    const size_type firstWord   = WordIndex(startPos);
+    const size_type lastWord    = WordIndex(lastPos);
+    const word_type firstMask   = ~word_type(0) << (startPos % WORD_BITS);
+    const word_type lastMask    = ~word_type(0) >> (WORD_BITS - 1 - (lastPos % WORD_BITS));
+
+    if(firstWord == lastWord)
+    {
+        Apply(firstWord, firstMask & lastMask, fillValue);
+
+        return *this;
+    }
+
+    Apply(firstWord, firstMask, fillValue);
+
+    for(size_type wordIdx = firstWord + 1; wordIdx < lastWord; ++wordIdx)
+        words[wordIdx] = fillValue ? ~word_type(0) : word_type(0);
+
+    Apply(lastWord, lastMask, fillValue);
+
+    return *this;
+}
+
+/**
+ * @brief   Position based fill operation
+ * @param   predicate   Rule for calculating the bit value using its position.
+ * @return  lValue reference to the array to support cascaded calls.
+ * @note    Each word is assembled in a register and written once.
+ */
+template<std::size_t SIZE>
+template<class RuleT>
+constexpr BitArray<SIZE>& BitArray<SIZE>::FillWithRule(const RuleT& predicate)
+{
+    for(size_type wordIdx = 0; wordIdx < WORD_COUNT; ++wordIdx)
+    {
+        const size_type firstPos    = wordIdx * WORD_BITS;
+        const size_type bitCount    = ((SIZE - firstPos) < WORD_BITS) ? (SIZE - firstPos) : WORD_BITS;
+        word_type       bitWord     = 0;
+
+        for(size_type bitIdx = 0; bitIdx < bitCount; ++bitIdx)
+        {
+            if(predicate(firstPos + bitIdx))
+                bitWord |= word_type(1) << bitIdx;
+        }
+
+        words[wordIdx] = bitWord;
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Counts the set bits
+ * @return  Number of set bits
+ */
+template<std::size_t SIZE>
+constexpr std::size_t BitArray<SIZE>::count() const noexcept
+{
+    size_type setBits = 0;
+
+    for(const word_type bitWord : words)
+        setBits += ContainerDetail::PopCount(bitWord);
+
+    return setBits;
+}
+
+/**
+ * @brief   Checks whether any bit is set
+ * @return  true if at least one bit is set
+ */
+template<std::size_t SIZE>
+constexpr bool BitArray<SIZE>::any() const noexcept
+{
+    for(const word_type bitWord : words)
+    {
+        if(0 != bitWord)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief   Finds the first set bit at or after the given position
+ * @param   position    Start position of the scan
+ * @return  Position of the set bit, npos if there is none
+ * @note    Cleared words are skipped with a single comparison each.
+ */
+template<std::size_t SIZE>
+constexpr std::size_t BitArray<SIZE>::find_next(const size_type position) const noexcept
+{
+    if(position >= SIZE)
+        return npos;
+
+    size_type wordIdx = WordIndex(position);
+    word_type bitWord = words[wordIdx] & (~word_type(0) << (position % WORD_BITS));
+
+    while(0 == bitWord)
+    {
+        if(++wordIdx == WORD_COUNT)
+            return npos;
+
+        bitWord = words[wordIdx];
+    }
+
+    return (wordIdx * WORD_BITS) + ContainerDetail::CountTrailingZeros(bitWord);
+}
+
+/**
+ * @brief   Finds the last set bit
+ * @return  Position of the set bit, npos if there is none
+ */
+template<std::size_t SIZE>
+constexpr std::size_t BitArray<SIZE>::find_last() const noexcept
+{
+    for(size_type wordIdx = WORD_COUNT; wordIdx-- > 0; )
+    {
+        if(0 != words[wordIdx])
+            return (wordIdx * WORD_BITS) + (WORD_BITS - 1 - ContainerDetail::CountLeadingZeros(words[wordIdx]));
+    }
+
+    return npos;
+}
@@ -0,0 +1,434 @@
+/**
+ * @file        BlockingQueue.h
+ * @details     A template blocking layer on top of a Queue.
+ *              Producers and consumers wait for a free slot or an element with a timeout instead of polling.
+ *              Waiting and waking are delegated to a backend, so the same adapter runs on an RTOS
+ *              (task notifications, semaphores) and on a host (std::condition_variable).
+ *              Waiters are woken only when data arrives or a slot is freed, and the backend is not
+ *              signalled at all when nobody waits.
+ *              With C++20 coroutines, co_await adapter.pop() suspends the coroutine until an element arrives.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Large host timeouts saturated instead of overflowing the deadline.
+ *
+ * @note        All accesses to the underlying Queue must go through the adapter once it is in use.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <utility>      // std::move, std::forward
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>    // std::coroutine_handle
+#include <optional>     // std::optional
+#define BLOCKING_QUEUE_COROUTINES 1
+#else
+#define BLOCKING_QUEUE_COROUTINES 0
+#endif
+
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+#include <mutex>                // std::mutex
+#include <condition_variable>   // std::condition_variable
+#include <chrono>               // std::chrono::milliseconds
+#endif
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Wait Backends ***/
+enum class WaitChannel{
+    NotEmpty,   // Consumers wait for an element
+    NotFull     // Producers wait for a free slot
+};
+
+/**
+ * @brief   A wait backend provides the following interface:
+ *
+ *          using timeout_type = ...;                       // e.g. TickType_t
+ *          static constexpr timeout_type forever = ...;    // e.g. portMAX_DELAY
+ *          void lock();                                    // Guards the Queue
+ *          void unlock();
+ *          template<class PredicateT>                      // Called with the lock held, releases it while blocked and
+ *          bool wait(WaitChannel, timeout_type, PredicateT);   // returns the final predicate once it holds or the timeout expires
+ *          void notify(WaitChannel);                       // Wakes one waiter of the channel, called without the lock
+ *
+ * @note    A FreeRTOS backend may guard with taskENTER_CRITICAL/taskEXIT_CRITICAL, record the waiting task
+ *          handle per channel, block in ulTaskNotifyTake and loop on xTaskCheckForTimeOut until the predicate holds.
+ *          notify(..) then becomes a single xTaskNotifyGive to the recorded task.
+ */
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+/**
+ * @brief   Host backend based on a mutex and a condition variable per channel
+ * @note    Timeouts reaching beyond the range of the steady clock are treated as forever and negative ones
+ *          as an immediate check, so the deadline never overflows.
+ */
+class ConditionVariableWait{
+public:
+    using timeout_type = std::chrono::milliseconds;
+    static constexpr timeout_type forever = timeout_type::max();
+
+    void lock()     { mutex.lock();     }
+    void unlock()   { mutex.unlock();   }
+
+    template<class PredicateT>
+    bool wait(const WaitChannel channel, const timeout_type timeout, PredicateT ready)
+    {
+        // The lock is already held by the adapter, it stays held on return
+        std::unique_lock<std::mutex> guard(mutex, std::adopt_lock);
+        std::condition_variable& condition = conditions[static_cast<std::size_t>(channel)];
+        bool result = true;
+
+        // Saturate the deadline, milliseconds cover a wider range than the clock's own ticks
+        const auto now          = std::chrono::steady_clock::now();
+        const auto remaining    = std::chrono::duration_cast<timeout_type>(std::chrono::steady_clock::time_point::max() - now);
+        const auto clamped      = (timeout < timeout_type::zero()) ? timeout_type::zero() : timeout;
+
+        if(clamped >= remaining)
+            condition.wait(guard, ready);
+        else
+            result = condition.wait_until(guard, now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(clamped), ready);
+
+        guard.release();
+
+        return result;
+    }
+
+    void notify(const WaitChannel channel) { conditions[static_cast<std::size_t>(channel)].notify_one(); }
+
+private:
+    std::mutex              mutex;
+    std::condition_variable conditions[2];
+};
+#endif
+
+/*** Container Class ***/
+/**
+ * @tparam  QueueT  Queue to be wrapped, e.g. Queue<Message, 16>
+ * @tparam  WaitT   Wait backend, e.g. ConditionVariableWait
+ */
+template<class QueueT, class WaitT>
+class BlockingQueue{
+public:
+    using value_type        = typename QueueT::value_type;
+    using reference         = value_type&;
+    using const_reference   = const value_type&;
+    using size_type         = std::size_t;
+    using timeout_type      = typename WaitT::timeout_type;
+
+#if BLOCKING_QUEUE_COROUTINES
+    class PopAwaiter;
+#endif
+
+    /*** Constructors and Destructor ***/
+    explicit BlockingQueue(QueueT& target) : queue(target) { /* No operation */ }
+
+    // The adapter refers to its Queue, hence it cannot be copied
+    BlockingQueue(const BlockingQueue&)             = delete;
+    BlockingQueue& operator=(const BlockingQueue&)  = delete;
+
+    /*** Modifiers ***/
+    bool push(const value_type& value)              { return push_wait(value, timeout_type{});            } // Fails immediately if the Queue is full
+    bool push(value_type&& value)                   { return push_wait(std::move(value), timeout_type{}); } // Fails immediately if the Queue is full
+    bool push_wait(const value_type& value, const timeout_type timeout = WaitT::forever);
+    bool push_wait(value_type&& value, const timeout_type timeout = WaitT::forever);
+
+    bool pop(value_type& destination)               { return pop_wait(destination, timeout_type{});       } // Fails immediately if the Queue is empty
+    bool pop_wait(value_type& destination, const timeout_type timeout = WaitT::forever);
+
+#if BLOCKING_QUEUE_COROUTINES
+    NODISCARD PopAwaiter pop() { return PopAwaiter(*this); }   // co_await returns the front element
+#endif
+
+    /*** Status Checkers ***/
+    NODISCARD size_type size();                     // Snapshot of the current size of the Queue
+    NODISCARD size_type capacity() const { return queue.capacity(); }
+
+    NODISCARD WaitT&    backend() { return waiter; }
+
+private:
+    /*** Members ***/
+    QueueT&     queue;                  // Wrapped Queue
+    WaitT       waiter;                 // Wait and notification backend
+    size_type   waitingConsumers{0};    // Blocked consumers, guarded by the backend lock
+    size_type   waitingProducers{0};    // Blocked producers, guarded by the backend lock
+
+#if BLOCKING_QUEUE_COROUTINES
+    PopAwaiter* firstAwaiter{nullptr};  // Suspended coroutines in arrival order, only queued while the Queue is empty
+    PopAwaiter* lastAwaiter{nullptr};
+#endif
+
+    /*** Helper functions ***/
+    template<class PredicateT>
+    bool Wait(const WaitChannel channel, size_type& waiters, const timeout_type timeout, PredicateT ready);
+
+    template<class... Args>
+    bool Publish(Args&&... args);       // Called with the lock held, releases it
+
+    void ReleaseSlot();                 // Called with the lock held after a pop, releases it
+};
+
+#if BLOCKING_QUEUE_COROUTINES
+/**
+ * @brief   Awaitable returned by pop(), resumes the coroutine with the front element
+ * @note    A suspended coroutine is resumed by the producer which delivers the element, in the producer's context.
+ */
+template<class QueueT, class WaitT>
+class BlockingQueue<QueueT, WaitT>::PopAwaiter{
+public:
+    explicit PopAwaiter(BlockingQueue& owner) : adapter(owner) { /* No operation */ }
+
+    bool await_ready();
+    bool await_suspend(std::coroutine_handle<> handle);
+    value_type await_resume() { return std::move(*element); }
+
+private:
+    friend class BlockingQueue;
+
+    BlockingQueue&              adapter;
+    std::optional<value_type>   element;            // Delivered element
+    std::coroutine_handle<>     continuation;       // Suspended coroutine
+    PopAwaiter*                 next{nullptr};      // Next suspended coroutine
+
+    bool TakeFront();                               // Called with the lock held, releases it on success
+};
+#endif
+
+/**
+ * @brief   Pushes the element, waits for a free slot if the Queue is full
+ * @param   value   Constant lValue reference to the object to be pushed
+ * @param   timeout Maximum time to wait, zero for no wait
+ * @return  true    If the operation is successful.
+ *          false   If the Queue stayed full until the timeout
+ */
+template<class QueueT, class WaitT>
+bool BlockingQueue<QueueT, WaitT>::push_wait(const value_type& value, const timeout_type timeout)
+{
+    waiter.lock();
+
+    if(!Wait(WaitChannel::NotFull, waitingProducers, timeout, [this]() { return !queue.full(); }))
+    {
+        waiter.unlock();
+
+        return false;
+    }
+
+    return Publish(value);
+}
+
+/**
+ * @brief   Pushes the element, waits for a free slot if the Queue is full
+ * @param   value   rValue reference to the object to be pushed
+ * @param   timeout Maximum time to wait, zero for no wait
+ * @return  true    If the operation is successful.
+ *          false   If the Queue stayed full until the timeout
+ */
+template<class QueueT, class WaitT>
+bool BlockingQueue<QueueT, WaitT>::push_wait(value_type&& value, const timeout_type timeout)
+{
+    waiter.lock();
+
+    if(!Wait(WaitChannel::NotFull, waitingProducers, timeout, [this]() { return !queue.full(); }))
+    {
+        waiter.unlock();
+
+        return false;
+    }
+
+    return Publish(std::move(value));
+}
+
+/**
+ * @brief   Pops the front element, waits for an element if the Queue is empty
+ * @param   destination Object to be assigned with the front element
+ * @param   timeout     Maximum time to wait, zero for no wait
+ * @return  true    If the operation is successful.
+ *          false   If the Queue stayed empty until the timeout
+ */
+template<class QueueT, class WaitT>
+bool BlockingQueue<QueueT, WaitT>::pop_wait(value_type& destination, const timeout_type timeout)
+{
+    waiter.lock();
+
+    if(!Wait(WaitChannel::NotEmpty, waitingConsumers, timeout, [this]() { return !queue.empty(); }))
+    {
+        waiter.unlock();
+
+        return false;
+    }
+
+    destination = std::move(queue.front());
+    queue.pop();
+
+    ReleaseSlot();
+
+    return true;
+}
+
+/**
+ * @brief   Returns the current size of the Queue
+ * @return  Number of elements, a snapshot when accessed concurrently
+ */
+template<class QueueT, class WaitT>
+std::size_t BlockingQueue<QueueT, WaitT>::size()
+{
+    waiter.lock();
+    const size_type currentSize = queue.size();
+    waiter.unlock();
+
+    return currentSize;
+}
+
+/**
+ * @brief   Waits until the predicate holds
+ * @param   channel     Channel to wait on
+ * @param   waiters     Number of waiters of the channel
+ * @param   timeout     Maximum time to wait, zero for no wait
+ * @param   ready       Condition to be waited for
+ * @return  true if the condition holds
+ * @note    Called with the lock held, the backend is bypassed if the condition already holds.
+ */
+template<class QueueT, class WaitT>
+template<class PredicateT>
+bool BlockingQueue<QueueT, WaitT>::Wait(const WaitChannel channel, size_type& waiters, const timeout_type timeout, PredicateT ready)
+{
+    if(ready())
+        return true;
+
+    if(timeout_type{} == timeout)
+        return false;
+
+    ++waiters;
+    const bool result = waiter.wait(channel, timeout, ready);
+    --waiters;
+
+    return result;
+}
+
+/**
+ * @brief   Delivers the element to a waiting coroutine or pushes it to the Queue, then wakes a consumer
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @return  true if the element is delivered
+ * @note    Called with the lock held, returns with the lock released.
+ *          A suspended coroutine takes precedence, it receives the element without a round trip through the Queue.
+ */
+template<class QueueT, class WaitT>
+template<class... Args>
+bool BlockingQueue<QueueT, WaitT>::Publish(Args&&... args)
+{
+#if BLOCKING_QUEUE_COROUTINES
+    if(nullptr != firstAwaiter)
+    {
+        PopAwaiter* const awaiter = firstAwaiter;
+
+        firstAwaiter = awaiter->next;
+        if(nullptr == firstAwaiter)
+            lastAwaiter = nullptr;
+
+        awaiter->element.emplace(std::forward<Args>(args)...);
+        waiter.unlock();
+
+        awaiter->continuation.resume();
+
+        return true;
+    }
+#endif
+
+    const bool pushed = queue.emplace(std::forward<Args>(args)...);
+    const bool wake   = pushed && (0 != waitingConsumers);
+
+    waiter.unlock();
+
+    if(wake)
+        waiter.notify(WaitChannel::NotEmpty);
+
+    return pushed;
+}
+
+/**
+ * @brief   Wakes a producer after a slot has been freed
+ * @note    Called with the lock held, returns with the lock released.
+ */
+template<class QueueT, class WaitT>
+void BlockingQueue<QueueT, WaitT>::ReleaseSlot()
+{
+    const bool wake = (0 != waitingProducers);
+
+    waiter.unlock();
+
+    if(wake)
+        waiter.notify(WaitChannel::NotFull);
+}
+
+#if BLOCKING_QUEUE_COROUTINES
+/**
+ * @brief   Takes the front element without suspension if there is any
+ * @return  true if the element is taken
+ */
+template<class QueueT, class WaitT>
+bool BlockingQueue<QueueT, WaitT>::PopAwaiter::await_ready()
+{
+    adapter.waiter.lock();
+
+    if(TakeFront())
+        return true;
+
+    adapter.waiter.unlock();
+
+    return false;
+}
+
+/**
+ * @brief   Suspends the coroutine until a producer delivers an element
+ * @param   handle  Coroutine to be resumed
+ * @return  false if an element arrived in the meantime, the coroutine then continues without suspension
+ */
+template<class QueueT, class WaitT>
+bool BlockingQueue<QueueT, WaitT>::PopAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    adapter.waiter.lock();
+
+    if(TakeFront())
+        return false;
+
+    continuation = handle;
+
+    if(nullptr == adapter.lastAwaiter)
+        adapter.firstAwaiter = this;
+    else
+        adapter.lastAwaiter->next = this;
+
+    adapter.lastAwaiter = this;
+    adapter.waiter.unlock();
+
+    return true;
+}
+
+/**
+ * @brief   Moves the front element of the Queue into the awaiter
+ * @return  true if the Queue was not empty
+ * @note    Called with the lock held, releases it only on success.
+ */
+template<class QueueT, class WaitT>
+bool BlockingQueue<QueueT, WaitT>::PopAwaiter::TakeFront()
+{
+    if(adapter.queue.empty())
+        return false;
+
+    element.emplace(std::move(adapter.queue.front()));
+    adapter.queue.pop();
+
+    adapter.ReleaseSlot();
+
+    return true;
+}
+#endif
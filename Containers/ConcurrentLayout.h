@@ -0,0 +1,73 @@
+/**
+ * @file        ConcurrentLayout.h
+ * @details     Memory layout policies for the concurrent queue containers.
+ *              On multi-core systems, indices written by different cores should not share a cache line,
+ *              otherwise the cores keep invalidating each other's copy of the line (false sharing).
+ *              The padded layout places each owned index on its own cache line and lets each side keep
+ *              a local copy of the opposite index, so the other side's line is only read when needed.
+ *              The compact layout keeps the indices next to each other, which suits single-core MCUs
+ *              where the padding would only waste RAM.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>  // std::size_t
+#include <atomic>   // std::atomic
+
+/*** Layout Policies ***/
+/**
+ * @brief   Indices are packed together without any padding or cached copy
+ */
+struct CompactLayout{
+    static constexpr std::size_t lineSize       = 0;        // Natural alignment of the index
+    static constexpr bool        cacheIndices   = false;    // Opposite index is always read from its owner
+};
+
+/**
+ * @brief   Each owned index is placed on its own cache line together with a cached copy of the opposite index
+ */
+template<std::size_t LINE_SIZE = 64>
+struct PaddedLayout{
+    static_assert(0 == (LINE_SIZE & (LINE_SIZE - 1)), "Cache line size must be a power of two!");
+
+    static constexpr std::size_t lineSize       = LINE_SIZE;
+    static constexpr bool        cacheIndices   = true;
+};
+
+/**
+ * @brief   Hosted (multi-core) targets are padded by default, bare metal targets are compact by default
+ */
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+using DefaultConcurrentLayout = PaddedLayout<>;
+#else
+using DefaultConcurrentLayout = CompactLayout;
+#endif
+
+namespace ContainerDetail {
+
+template<class IndexT, class LayoutT>
+inline constexpr std::size_t IndexAlignment = (0 == LayoutT::lineSize) ? alignof(std::atomic<IndexT>) : LayoutT::lineSize;
+
+/**
+ * @brief   An index owned (written) by a single side of a concurrent queue
+ * @note    The cached member holds the last observed value of the opposite side's index.
+ */
+template<class IndexT, class LayoutT, bool = LayoutT::cacheIndices>
+struct alignas(IndexAlignment<IndexT, LayoutT>) OwnedIndex{
+    std::atomic<IndexT> value{0};
+};
+
+template<class IndexT, class LayoutT>
+struct alignas(IndexAlignment<IndexT, LayoutT>) OwnedIndex<IndexT, LayoutT, true>{
+    std::atomic<IndexT> value{0};
+    IndexT              cached{0};
+};
+
+} // namespace ContainerDetail
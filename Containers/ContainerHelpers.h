@@ -0,0 +1,327 @@
+/**
+ * @file        ContainerHelpers.h
+ * @details     Helper functions shared by the containers built on uninitialized storage.
+ *              Element ranges are constructed, moved and destroyed in bulk. Trivially copyable
+ *              element types are handled with a single memcpy per contiguous range.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Gap helpers added for the sorted and positional insertions.
+ *                               -> Compile time table diagnostics added.
+ *                               -> Word level bit scan and population count helpers added.
+ *                               -> Constant evaluation detection extended to clang based compilers.
+ *                               -> Bit scan helpers kept correct on targets with a 16-bit int.
+ *
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <cstdint>      // Fixed width integer types
+#include <cstring>      // std::memcpy, std::memset
+#include <utility>      // std::move
+#include <type_traits>  // Compile time controls
+#include <new>          // operator new
+
+namespace ContainerDetail {
+
+/**
+ * @brief   Narrowest unsigned integer type that can hold the given maximum value
+ * @note    Used for the index members of the containers to reduce their footprint.
+ */
+template<std::size_t MAX>
+using SmallestIndex = std::conditional_t<(MAX <= UINT8_MAX),  std::uint8_t,
+                      std::conditional_t<(MAX <= UINT16_MAX), std::uint16_t,
+                      std::conditional_t<(MAX <= UINT32_MAX), std::uint32_t,
+                                                              std::size_t>>>;
+
+/**
+ * @brief   Detects whether the call is evaluated at compile time
+ * @return  true if the caller is being constant evaluated
+ * @note    The builtin is detected through __has_builtin on clang based compilers, which report
+ *          an old __GNUC__ version. Compilers truly lacking the detection support always report
+ *          a constant evaluation, which selects the constexpr compatible (generic) path.
+ */
+constexpr bool IsConstantEvaluated() noexcept
+{
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+    return __builtin_is_constant_evaluated();
+#elif defined(__GNUC__) && (__GNUC__ >= 9)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+#elif defined(__GNUC__) && (__GNUC__ >= 9)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief   true if a range can be copied from the iterator to a T buffer with memcpy
+ */
+template<class T, class IteratorT>
+constexpr bool IsMemcpyable = std::is_pointer_v<IteratorT>                                           &&
+                              std::is_same_v<std::remove_cv_t<std::remove_pointer_t<IteratorT>>, T>  &&
+                              std::is_trivially_copyable_v<T>;
+
+/**
+ * @brief   Copy constructs elements into uninitialized storage
+ * @param   destination     Uninitialized storage for at least count elements
+ * @param   source          Iterator to the first element to be copied
+ * @param   count           Number of elements to be copied
+ * @return  Iterator to the element after the last copied one
+ */
+template<class T, class InputIt>
+InputIt ConstructRange(T* const destination, InputIt source, const std::size_t count)
+{
+    if constexpr(IsMemcpyable<T, InputIt>)
+    {
+        if(0 != count)
+            std::memcpy(static_cast<void*>(destination), source, count * sizeof(T));
+
+        return source + count;
+    }
+    else
+    {
+        for(std::size_t index = 0; index < count; ++index, ++source)
+            new(destination + index) T(*source);
+
+        return source;
+    }
+}
+
+/**
+ * @brief   Move constructs elements into uninitialized storage and destroys the sources
+ * @param   destination     Uninitialized storage for at least count elements
+ * @param   source          First element to be relocated
+ * @param   count           Number of elements to be relocated
+ * @note    The ranges must not overlap.
+ */
+template<class T>
+void RelocateRange(T* const destination, T* const source, const std::size_t count)
+{
+    if constexpr(std::is_trivially_copyable_v<T>)
+    {
+        if(0 != count)
+            std::memcpy(static_cast<void*>(destination), source, count * sizeof(T));
+    }
+    else
+    {
+        for(std::size_t index = 0; index < count; ++index)
+        {
+            new(destination + index) T(std::move(source[index]));
+            source[index].~T();
+        }
+    }
+}
+
+/**
+ * @brief   Moves elements out to an output iterator and destroys the sources
+ * @param   source          First element to be moved out
+ * @param   count           Number of elements to be moved out
+ * @param   destination     Iterator to the first already constructed destination element
+ * @return  Iterator to the element after the last assigned one
+ */
+template<class T, class OutputIt>
+OutputIt MoveOutRange(T* const source, const std::size_t count, OutputIt destination)
+{
+    if constexpr(IsMemcpyable<T, OutputIt>)
+    {
+        if(0 != count)
+            std::memcpy(static_cast<void*>(destination), source, count * sizeof(T));
+
+        return destination + count;
+    }
+    else
+    {
+        for(std::size_t index = 0; index < count; ++index, ++destination)
+        {
+            *destination = std::move(source[index]);
+            source[index].~T();
+        }
+
+        return destination;
+    }
+}
+
+/**
+ * @brief   Fills a range with memset if every byte of the value is the same
+ * @param   first   First element to be filled
+ * @param   count   Number of elements to be filled
+ * @param   value   Fill value
+ * @return  true    If the range is filled
+ *          false   If the value is not a repeated byte pattern, the range is untouched
+ * @note    Byte sized types and the common clear patterns (e.g. 0, all ones) are covered.
+ *          The library memset is word-wide or vectorized on most targets.
+ */
+template<class T>
+bool FillBytes(T* const first, const std::size_t count, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Bytewise fill requires a trivially copyable type!");
+
+    unsigned char pattern[sizeof(T)];
+    std::memcpy(pattern, &value, sizeof(T));
+
+    for(std::size_t index = 1; index < sizeof(T); ++index)
+    {
+        if(pattern[index] != pattern[0])
+            return false;
+    }
+
+    std::memset(static_cast<void*>(first), pattern[0], count * sizeof(T));
+
+    return true;
+}
+
+/**
+ * @brief   Shifts the elements after the given position one slot to the right
+ * @param   first       First element of the range
+ * @param   position    Position of the gap to be opened
+ * @param   count       Number of elements in the range, the slot at first[count] must be uninitialized
+ * @note    The slot at the position is left uninitialized. Trivially copyable types are shifted with memmove.
+ */
+template<class T>
+void OpenGap(T* const first, const std::size_t position, const std::size_t count)
+{
+    if constexpr(std::is_trivially_copyable_v<T>)
+    {
+        if(position != count)
+            std::memmove(static_cast<void*>(first + position + 1), first + position, (count - position) * sizeof(T));
+    }
+    else if(position != count)
+    {
+        // The last element is moved into the uninitialized slot, the rest are move assigned
+        new(first + count) T(std::move(first[count - 1]));
+
+        for(std::size_t index = count - 1; index > position; --index)
+            first[index] = std::move(first[index - 1]);
+
+        first[position].~T();
+    }
+}
+
+/**
+ * @brief   Destroys the element at the given position and shifts the following elements one slot to the left
+ * @param   first       First element of the range
+ * @param   position    Position of the element to be removed
+ * @param   count       Number of elements in the range
+ * @note    The slot at first[count - 1] is left uninitialized. Trivially copyable types are shifted with memmove.
+ */
+template<class T>
+void CloseGap(T* const first, const std::size_t position, const std::size_t count)
+{
+    if constexpr(std::is_trivially_copyable_v<T>)
+    {
+        if(position + 1 != count)
+            std::memmove(static_cast<void*>(first + position), first + position + 1, (count - position - 1) * sizeof(T));
+    }
+    else
+    {
+        for(std::size_t index = position + 1; index < count; ++index)
+            first[index - 1] = std::move(first[index]);
+
+        first[count - 1].~T();
+    }
+}
+
+/**
+ * @brief   Destroys the elements in the given range
+ * @param   first   First element to be destroyed
+ * @param   count   Number of elements to be destroyed
+ * @note    Compiles to nothing for trivially destructible types
+ */
+template<class T>
+void DestroyRange(T* const first, const std::size_t count)
+{
+    if constexpr(!std::is_trivially_destructible_v<T>)
+    {
+        for(std::size_t index = 0; index < count; ++index)
+            first[index].~T();
+    }
+}
+
+/**
+ * @brief   Called by the constexpr lookup table constructors when a key is repeated
+ * @note    It is not a constant expression, so a compile time table with duplicate keys fails to compile.
+ */
+inline void DuplicateKeyInConstantTable() { /* No operation */ }
+
+/**
+ * @brief   Number of set bits in a word
+ * @param   word    Word to be counted
+ * @return  Number of set bits
+ * @note    Compiles to a single instruction where the target has one (e.g. VCNT based sequence on Cortex-M, POPCNT on x86).
+ */
+constexpr unsigned PopCount(const std::uint32_t word) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr(sizeof(unsigned) >= sizeof(std::uint32_t))
+        return static_cast<unsigned>(__builtin_popcount(word));
+    else
+        return static_cast<unsigned>(__builtin_popcountl(word));    // Narrow int targets (e.g. AVR, MSP430)
+#else
+    // SWAR reduction, pairs, nibbles and bytes are summed in place
+    std::uint32_t bits = word - ((word >> 1) & 0x55555555u);
+    bits = (bits & 0x33333333u) + ((bits >> 2) & 0x33333333u);
+    bits = (bits + (bits >> 4)) & 0x0F0F0F0Fu;
+
+    return static_cast<unsigned>((bits * 0x01010101u) >> 24);
+#endif
+}
+
+/**
+ * @brief   Index of the least significant set bit of a word
+ * @param   word    Word to be scanned, must not be zero
+ * @return  Number of trailing zero bits
+ * @note    Compiles to RBIT + CLZ on Cortex-M3 and above, TZCNT/BSF on x86.
+ */
+constexpr unsigned CountTrailingZeros(const std::uint32_t word) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr(sizeof(unsigned) >= sizeof(std::uint32_t))
+        return static_cast<unsigned>(__builtin_ctz(word));
+    else
+        return static_cast<unsigned>(__builtin_ctzl(word));        // Narrow int targets (e.g. AVR, MSP430)
+#else
+    unsigned count = 0;
+
+    for(std::uint32_t bits = word; 0 == (bits & 1u); bits >>= 1)
+        ++count;
+
+    return count;
+#endif
+}
+
+/**
+ * @brief   Index of the most significant set bit of a word, counted from the top
+ * @param   word    Word to be scanned, must not be zero
+ * @return  Number of leading zero bits
+ * @note    Compiles to a single CLZ on Cortex-M3 and above, LZCNT/BSR on x86.
+ */
+constexpr unsigned CountLeadingZeros(const std::uint32_t word) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    // The builtins count over their own operand width, the bits above the word are subtracted
+    if constexpr(sizeof(unsigned) >= sizeof(std::uint32_t))
+        return static_cast<unsigned>(__builtin_clz(word)) - (8 * sizeof(unsigned) - 32);
+    else
+        return static_cast<unsigned>(__builtin_clzl(word)) - (8 * sizeof(unsigned long) - 32);
+#else
+    unsigned count = 0;
+
+    for(std::uint32_t bits = word; 0 == (bits & 0x80000000u); bits <<= 1)
+        ++count;
+
+    return count;
+#endif
+}
+
+} // namespace ContainerDetail
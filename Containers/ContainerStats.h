@@ -0,0 +1,170 @@
+/**
+ * @file        ContainerStats.h
+ * @details     Compile time selectable usage statistics for the Queue and Stack containers.
+ *              The statistics help sizing the capacities from real data: peak size, failed pushes
+ *              on a full container, pops on an empty container and optionally the time each element
+ *              spent in the container, measured with a user supplied timestamp source.
+ *              The default policy has no members and empty hooks, hence it compiles to nothing.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Unused slot count added for capacity trimming.
+ *
+ * @note        A timestamp source is a class with a static Now() method returning an unsigned tick count,
+ *              e.g. a wrapper around the DWT cycle counter or a free-running hardware timer.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <cstdint>      // Fixed width integer types
+#include "ContainerHelpers.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+namespace ContainerDetail {
+
+/**
+ * @brief   Tracker without any statistics, every hook is an empty inline function
+ */
+struct NullTracker{
+    using size_type = std::size_t;
+
+    static constexpr bool enabled = false;
+
+    void OnPush(size_type, size_type, size_type)    { /* No operation */ }
+    void OnPop(size_type, size_type)                { /* No operation */ }
+    void OnPushFailed()                             { /* No operation */ }
+    void OnPopEmpty()                               { /* No operation */ }
+};
+
+/**
+ * @brief   Timestamps of the stored elements and the latency figures derived from them
+ * @note    Elements are tracked per storage slot, so the slots are wrapped at the capacity.
+ */
+template<std::size_t SIZE, class ClockT>
+class LatencyTracker{
+public:
+    using size_type = std::size_t;
+    using tick_type = decltype(ClockT::Now());
+
+    NODISCARD tick_type     latency_min()       const { return (0 == samples) ? 0 : minLatency; }   // Shortest time spent in the container
+    NODISCARD tick_type     latency_max()       const { return maxLatency;                      }   // Longest time spent in the container
+    NODISCARD std::uint64_t latency_total()     const { return totalLatency;                    }   // Sum of the measured latencies
+    NODISCARD std::uint32_t latency_samples()   const { return samples;                         }   // Number of measured latencies
+
+protected:
+    void Stamp(size_type slotIdx, const size_type count)
+    {
+        const tick_type now = ClockT::Now();
+
+        for(size_type index = 0; index < count; ++index, slotIdx = (SIZE-1 == slotIdx) ? 0 : slotIdx+1)
+            stamps[slotIdx] = now;
+    }
+
+    void Measure(size_type slotIdx, const size_type count)
+    {
+        const tick_type now = ClockT::Now();
+
+        for(size_type index = 0; index < count; ++index, slotIdx = (SIZE-1 == slotIdx) ? 0 : slotIdx+1)
+        {
+            const tick_type latency = static_cast<tick_type>(now - stamps[slotIdx]);   // Unsigned wraparound safe
+
+            minLatency      = ((0 == samples) || (latency < minLatency)) ? latency : minLatency;
+            maxLatency      = (latency > maxLatency) ? latency : maxLatency;
+            totalLatency   += latency;
+            ++samples;
+        }
+    }
+
+private:
+    tick_type       stamps[SIZE]{};     // Push time of the element at each slot
+    tick_type       minLatency{0};
+    tick_type       maxLatency{0};
+    std::uint64_t   totalLatency{0};
+    std::uint32_t   samples{0};
+};
+
+/**
+ * @brief   Counters only, used when there is no timestamp source
+ */
+template<std::size_t SIZE>
+class LatencyTracker<SIZE, void>{
+protected:
+    void Stamp(std::size_t, std::size_t)    { /* No operation */ }
+    void Measure(std::size_t, std::size_t)  { /* No operation */ }
+};
+
+/**
+ * @brief   Tracker of the usage statistics of a container
+ */
+template<std::size_t SIZE, class ClockT>
+class UsageTracker : public LatencyTracker<SIZE, ClockT>{
+public:
+    using size_type = std::size_t;
+
+    static constexpr bool enabled = true;
+
+    NODISCARD size_type     peak_size()     const { return peakSize;        } // Largest size reached
+    NODISCARD size_type     unused_slots()  const { return SIZE - peakSize; } // Slots never occupied, candidates to be trimmed from the capacity
+    NODISCARD std::uint32_t failed_pushes() const { return failedPushes;    } // Pushes rejected as the container was full
+    NODISCARD std::uint32_t empty_pops()    const { return emptyPops;       } // Pops requested while the container was empty
+
+    /**
+     * @brief   Called after count elements are placed starting from the given slot
+     */
+    void OnPush(const size_type firstSlot, const size_type count, const size_type sizeAfter)
+    {
+        this->Stamp(firstSlot, count);
+
+        if(sizeAfter > peakSize)
+            peakSize = static_cast<SmallestIndex<SIZE>>(sizeAfter);
+    }
+
+    /**
+     * @brief   Called before count elements are removed starting from the given slot
+     */
+    void OnPop(const size_type firstSlot, const size_type count)
+    {
+        this->Measure(firstSlot, count);
+    }
+
+    void OnPushFailed()     { ++failedPushes;   }
+    void OnPopEmpty()       { ++emptyPops;      }
+
+private:
+    SmallestIndex<SIZE> peakSize{0};
+    std::uint32_t       failedPushes{0};
+    std::uint32_t       emptyPops{0};
+};
+
+} // namespace ContainerDetail
+
+/*** Statistics Policies ***/
+/**
+ * @brief   No statistics, the default policy of the containers
+ */
+struct NoStats{
+    template<std::size_t SIZE>
+    using Tracker = ContainerDetail::NullTracker;
+};
+
+/**
+ * @brief   Peak size, failed push and empty pop counters
+ * @tparam  ClockT  Optional timestamp source to measure the time spent by each element in the container
+ * @note    The timestamp source adds a tick_type timestamp per storage slot to the container.
+ */
+template<class ClockT = void>
+struct UsageStats{
+    template<std::size_t SIZE>
+    using Tracker = ContainerDetail::UsageTracker<SIZE, ClockT>;
+};
@@ -0,0 +1,433 @@
+/**
+ * @file        DequeContainer.h
+ * @details     A template double-ended queue container for embedded systems.
+ *              The container is implemented without any dynamic allocation feature.
+ *              It shares the ring storage and the index bookkeeping of the Queue container,
+ *              and adds O(1) insertion and removal at the front as well as at the back.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> footprint_bytes() added for memory budgets.
+ *
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <utility>      // std::move, std::forward
+#include <type_traits>  // std::aligned_storage
+#include <new>          // operator new
+#include <algorithm>    // std::min
+#include "ContainerHelpers.h"
+#include "QueueContainer.h"
+#include "Span.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+template<class T, std::size_t SIZE>
+class Deque{
+    static_assert(SIZE != 0, "Deque capacity cannot be zero!");
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type        = T;
+    using reference         = T&;
+    using const_reference   = const T&;
+    using pointer           = T*;
+    using const_pointer     = const T*;
+    using iterator          = ContainerDetail::RingIterator<T, SIZE>;
+    using const_iterator    = ContainerDetail::RingIterator<const T, SIZE>;
+    using difference_type   = std::ptrdiff_t;
+    using size_type         = std::size_t;
+    using aligned_data      = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    /*** Constructors and Destructor ***/
+    // Default constructor
+    Deque() = default;
+
+    // Copy constructor
+    Deque(const Deque& copyDeque);
+
+    // Move constructor
+    Deque(Deque&& moveDeque) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    // Destructor
+    ~Deque();
+
+    /*** Element Access ***/
+    NODISCARD const_reference front() const  { return at(indices.front());         }
+    NODISCARD reference       front()        { return at(indices.front());         }
+    NODISCARD const_reference back() const   { return at(indices.back());          }
+    NODISCARD reference       back()         { return at(indices.back());          }
+
+    NODISCARD const_reference operator[](const size_type position) const  { return at(indices.slot(position)); }
+    NODISCARD reference       operator[](const size_type position)        { return at(indices.slot(position)); }
+
+    NODISCARD SpanPair<const value_type>  segments() const;
+    NODISCARD SpanPair<value_type>        segments();
+
+    /*** Iterators ***/
+    NODISCARD const_iterator begin()    const   { return const_iterator(slot(0), indices.front(), 0);      }
+    NODISCARD const_iterator end()      const   { return const_iterator(slot(0), indices.front(), size()); }
+    NODISCARD iterator       begin()            { return iterator(slot(0), indices.front(), 0);            }
+    NODISCARD iterator       end()              { return iterator(slot(0), indices.front(), size());       }
+    NODISCARD const_iterator cbegin()   const   { return begin();                                          }
+    NODISCARD const_iterator cend()     const   { return end();                                            }
+
+    /*** Modifiers ***/
+    template <class... Args>
+    bool emplace_back(Args&&... args);
+    bool push_back(const value_type& value);
+    bool push_back(value_type&& value);
+
+    template <class... Args>
+    bool emplace_front(Args&&... args);
+    bool push_front(const value_type& value);
+    bool push_front(value_type&& value);
+
+    void pop_front();
+    void pop_back();
+    void clear();
+
+    /*** Status Checkers ***/
+    NODISCARD bool      empty()     const { return (0     == size()); } // true if the Deque is empty
+    NODISCARD bool      full()      const { return (SIZE  == size()); } // true if the Deque is full
+    NODISCARD size_type size()      const { return indices.size();    } // Current size of the Deque
+    NODISCARD size_type capacity()  const { return SIZE;              } // Maximum capacity of the Deque
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(Deque); } // Memory taken by an instance, including bookkeeping and padding
+    NODISCARD size_type available() const { return (SIZE - size());   } // Available slots in Deque
+
+    /*** Operators ***/
+    bool operator==(const Deque& compDeque) const;
+    bool operator!=(const Deque& compDeque) const;
+    Deque& operator=(const Deque& sourceDeque) &;
+    Deque& operator=(Deque&& sourceDeque) & noexcept(std::is_nothrow_move_constructible_v<T>);
+
+private:
+    /*** Members ***/
+    ContainerDetail::RingIndex<SIZE> indices;   // Front, back and size bookkeeping
+    aligned_data data[SIZE];                    // Stored data
+
+    /*** Helper functions ***/
+    NODISCARD const_reference at(const size_type slotIdx) const
+    {
+        return reinterpret_cast<const_reference>(data[slotIdx]);
+    }
+
+    NODISCARD reference at(const size_type slotIdx)
+    {
+        return reinterpret_cast<reference>(data[slotIdx]);
+    }
+
+    NODISCARD const_pointer slot(const size_type slotIdx) const
+    {
+        return reinterpret_cast<const_pointer>(data + slotIdx);
+    }
+
+    NODISCARD pointer slot(const size_type slotIdx)
+    {
+        return reinterpret_cast<pointer>(data + slotIdx);
+    }
+
+    void MoveFrom(Deque& sourceDeque) noexcept(std::is_nothrow_move_constructible_v<T>);
+};
+
+/**
+ * @brief Copy constructor
+ * @param copyDeque     Source Deque for copying
+ */
+template<class T, std::size_t SIZE>
+Deque<T, SIZE>::Deque(const Deque& copyDeque)
+{
+    *this = copyDeque;
+}
+
+/**
+ * @brief   Move constructor
+ * @param   moveDeque   Deque to be moved from, it is left empty
+ */
+template<class T, std::size_t SIZE>
+Deque<T, SIZE>::Deque(Deque&& moveDeque) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    MoveFrom(moveDeque);
+}
+
+/**
+ * @brief   Destructor
+ * @note    Calls the destructor of each element explicitly
+ */
+template<class T, std::size_t SIZE>
+Deque<T, SIZE>::~Deque()
+{
+    // Nothing to be done for trivially destructible types
+    if constexpr(!std::is_trivially_destructible_v<T>)
+        clear();
+}
+
+/**
+ * @brief   Returns the elements of the Deque as two contiguous regions
+ * @return  Constant views over the front region and the wrapped region at the beginning of the storage
+ * @note    The second region is empty if the elements do not wrap around.
+ */
+template<class T, std::size_t SIZE>
+SpanPair<const T> Deque<T, SIZE>::segments() const
+{
+    const size_type firstChunk = std::min(size(), SIZE - indices.front());
+
+    return { Span<const value_type>(slot(indices.front()), firstChunk), Span<const value_type>(slot(0), size() - firstChunk) };
+}
+
+/**
+ * @brief   Returns the elements of the Deque as two contiguous regions
+ * @return  Views over the front region and the wrapped region at the beginning of the storage
+ * @note    The second region is empty if the elements do not wrap around.
+ */
+template<class T, std::size_t SIZE>
+SpanPair<T> Deque<T, SIZE>::segments()
+{
+    const size_type firstChunk = std::min(size(), SIZE - indices.front());
+
+    return { Span<value_type>(slot(indices.front()), firstChunk), Span<value_type>(slot(0), size() - firstChunk) };
+}
+
+/**
+ * @brief   Pushes the element to the back by constructing it in-place with the given arguments
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @return  true    If the operation is successful.
+ *          false   If the Deque was full
+ */
+template<class T, std::size_t SIZE>
+template <class... Args>
+bool Deque<T, SIZE>::emplace_back(Args&&... args)
+{
+    if(full())
+        return false;
+
+    // In-place construct element with the arguments after the back
+    new(data + indices.next()) value_type(std::forward<Args>(args)...);
+
+    // Adjust back index and size
+    indices.pushBack();
+
+    return true;
+}
+
+/**
+ * @brief   Pushes the element to the back of the Deque
+ * @param   value   Constant lValue reference to the object to be pushed
+ * @return  true    If the operation is successful.
+ *          false   If the Deque was full
+ */
+template<class T, std::size_t SIZE>
+bool Deque<T, SIZE>::push_back(const value_type& value)
+{
+    return emplace_back(value);
+}
+
+/**
+ * @brief   Pushes the element to the back of the Deque
+ * @param   value   rValue reference to the object to be pushed
+ * @return  true    If the operation is successful.
+ *          false   If the Deque was full
+ */
+template<class T, std::size_t SIZE>
+bool Deque<T, SIZE>::push_back(value_type&& value)
+{
+    return emplace_back(std::move(value));
+}
+
+/**
+ * @brief   Pushes the element to the front by constructing it in-place with the given arguments
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @return  true    If the operation is successful.
+ *          false   If the Deque was full
+ */
+template<class T, std::size_t SIZE>
+template <class... Args>
+bool Deque<T, SIZE>::emplace_front(Args&&... args)
+{
+    if(full())
+        return false;
+
+    // In-place construct element with the arguments before the front
+    new(data + indices.prev()) value_type(std::forward<Args>(args)...);
+
+    // Adjust front index and size
+    indices.pushFront();
+
+    return true;
+}
+
+/**
+ * @brief   Pushes the element to the front of the Deque
+ * @param   value   Constant lValue reference to the object to be pushed
+ * @return  true    If the operation is successful.
+ *          false   If the Deque was full
+ */
+template<class T, std::size_t SIZE>
+bool Deque<T, SIZE>::push_front(const value_type& value)
+{
+    return emplace_front(value);
+}
+
+/**
+ * @brief   Pushes the element to the front of the Deque
+ * @param   value   rValue reference to the object to be pushed
+ * @return  true    If the operation is successful.
+ *          false   If the Deque was full
+ */
+template<class T, std::size_t SIZE>
+bool Deque<T, SIZE>::push_front(value_type&& value)
+{
+    return emplace_front(std::move(value));
+}
+
+/**
+ * @brief   Pops the front element of the Deque
+ * @note    Explicitly calls the destructor of the popped element
+ */
+template<class T, std::size_t SIZE>
+void Deque<T, SIZE>::pop_front()
+{
+    if(empty())
+        return;
+
+    // Explicitly call the destructor as we used the placement new
+    at(indices.front()).~value_type();
+
+    // Adjust front index and size
+    indices.popFront();
+}
+
+/**
+ * @brief   Pops the back element of the Deque
+ * @note    Explicitly calls the destructor of the popped element
+ */
+template<class T, std::size_t SIZE>
+void Deque<T, SIZE>::pop_back()
+{
+    if(empty())
+        return;
+
+    // Explicitly call the destructor as we used the placement new
+    at(indices.back()).~value_type();
+
+    // Adjust back index and size
+    indices.popBack();
+}
+
+/**
+ * @brief   Removes all elements of the Deque
+ * @note    Explicitly calls the destructor of each element
+ */
+template<class T, std::size_t SIZE>
+void Deque<T, SIZE>::clear()
+{
+    const SpanPair<value_type> content = segments();
+
+    ContainerDetail::DestroyRange(content.first.data(), content.first.size());
+    ContainerDetail::DestroyRange(content.second.data(), content.second.size());
+
+    indices.reset(0);
+}
+
+/**
+ * @brief   Comparison operator
+ * @param   compDeque   Deque to be compared with.
+ * @return  true        If both Deques are equal.
+ */
+template<class T, std::size_t SIZE>
+bool Deque<T, SIZE>::operator==(const Deque& compDeque) const
+{
+    if(compDeque.size() != size())  // Size must be equal
+        return false;
+
+    // Element-wise comparison
+    for(size_type position = 0; position < size(); ++position)
+    {
+        if(compDeque[position] != (*this)[position])
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Incomparison operator
+ * @param   compDeque   Deque to be compared with.
+ * @return  true        If Deques are not equal.
+ */
+template<class T, std::size_t SIZE>
+bool Deque<T, SIZE>::operator!=(const Deque& compDeque) const
+{
+    return !(*this == compDeque);
+}
+
+/**
+ * @brief   Copy assignment operator
+ * @param   sourceDeque     Deque to be copied from
+ * @return  lValue reference to the left Deque to support cascaded operations
+ */
+template<class T, std::size_t SIZE>
+Deque<T, SIZE>& Deque<T, SIZE>::operator=(const Deque& sourceDeque) &
+{
+    if(this == &sourceDeque)    // Check self copy
+        return *this;
+
+    clear();
+
+    // Copy construct the elements in at most two contiguous chunks
+    const SpanPair<const value_type> content = sourceDeque.segments();
+
+    ContainerDetail::ConstructRange(slot(0), content.first.data(), content.first.size());
+    ContainerDetail::ConstructRange(slot(content.first.size()), content.second.data(), content.second.size());
+
+    indices.reset(content.size());
+
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator
+ * @param   sourceDeque     Deque to be moved from, it is left empty
+ * @return  lValue reference to the left Deque to support cascaded operations
+ */
+template<class T, std::size_t SIZE>
+Deque<T, SIZE>& Deque<T, SIZE>::operator=(Deque&& sourceDeque) & noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if(this == &sourceDeque)    // Check self move
+        return *this;
+
+    clear();
+    MoveFrom(sourceDeque);
+
+    return *this;
+}
+
+/**
+ * @brief   Relocates the elements of an empty Deque from another one
+ * @param   sourceDeque     Deque to be moved from, it is left empty
+ * @note    Elements keep their storage slots, so the indices are taken over as is.
+ */
+template<class T, std::size_t SIZE>
+void Deque<T, SIZE>::MoveFrom(Deque& sourceDeque) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    const size_type firstSlot   = sourceDeque.indices.front();
+    const size_type firstChunk  = std::min(sourceDeque.size(), SIZE - firstSlot);
+
+    ContainerDetail::RelocateRange(slot(firstSlot), sourceDeque.slot(firstSlot), firstChunk);
+    ContainerDetail::RelocateRange(slot(0), sourceDeque.slot(0), sourceDeque.size() - firstChunk);
+
+    indices = sourceDeque.indices;
+    sourceDeque.indices.reset(0);
+}
@@ -0,0 +1,470 @@
+/**
+ * @file        FlatMapContainer.h
+ * @details     Template sorted associative containers for embedded systems.
+ *              The containers are implemented without any dynamic allocation feature.
+ *              Keys are kept sorted in a contiguous storage, separately from the values,
+ *              so a lookup is a binary search over a dense key array.
+ *              FlatMap is modifiable at run time. ConstFlatMap is built and sorted at compile time,
+ *              so a constexpr instance can be placed in flash as a read-only lookup table.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> footprint_bytes() added for memory budgets.
+ *
+ * @note        Insertion and removal are O(n) as the following elements are shifted, lookup is O(log n).
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <utility>      // std::move, std::forward, std::pair
+#include <type_traits>  // std::aligned_storage
+#include <functional>   // std::less
+#include <new>          // operator new
+#include "ContainerHelpers.h"
+#include "Span.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+template<class K, class V, std::size_t SIZE, class Compare = std::less<K>>
+class FlatMap{
+    static_assert(SIZE != 0, "FlatMap capacity cannot be zero!");
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using key_type          = K;
+    using mapped_type       = V;
+    using key_compare       = Compare;
+    using difference_type   = std::ptrdiff_t;
+    using size_type         = std::size_t;
+    using aligned_key       = typename std::aligned_storage<sizeof(K), alignof(K)>::type;
+    using aligned_value     = typename std::aligned_storage<sizeof(V), alignof(V)>::type;
+
+    /*** Constructors and Destructor ***/
+    // Default constructor
+    explicit FlatMap(const Compare& comparator = Compare()) : compare(comparator) { /* No operation */ }
+
+    // Copy constructor
+    FlatMap(const FlatMap& copyMap);
+
+    // Move constructor
+    FlatMap(FlatMap&& moveMap) noexcept(std::is_nothrow_move_constructible_v<K> && std::is_nothrow_move_constructible_v<V>);
+
+    // Destructor
+    ~FlatMap();
+
+    /*** Lookup ***/
+    NODISCARD const mapped_type*    find(const key_type& searchKey) const;
+    NODISCARD mapped_type*          find(const key_type& searchKey);
+    NODISCARD bool                  contains(const key_type& searchKey) const { return (nullptr != find(searchKey)); }
+
+    /*** Element Access ***/
+    NODISCARD Span<const key_type>      keys()      const { return Span<const key_type>(key(0), sz);      } // Sorted keys
+    NODISCARD Span<const mapped_type>   values()    const { return Span<const mapped_type>(value(0), sz); } // Values in the key order
+    NODISCARD Span<mapped_type>         values()          { return Span<mapped_type>(value(0), sz);       } // Values in the key order
+
+    /*** Modifiers ***/
+    template <class... Args>
+    bool emplace(const key_type& newKey, Args&&... args);
+    bool insert(const key_type& newKey, const mapped_type& newValue);
+    bool insert(const key_type& newKey, mapped_type&& newValue);
+    template <class M>
+    bool insert_or_assign(const key_type& newKey, M&& newValue);
+    bool erase(const key_type& oldKey);
+    void clear();
+
+    /*** Status Checkers ***/
+    NODISCARD bool      empty()     const { return (0     == sz);     } // true if the FlatMap is empty
+    NODISCARD bool      full()      const { return (SIZE  == sz);     } // true if the FlatMap is full
+    NODISCARD size_type size()      const { return sz;                } // Current number of entries
+    NODISCARD size_type capacity()  const { return SIZE;              } // Maximum number of entries
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(FlatMap); } // Memory taken by an instance, including bookkeeping and padding
+    NODISCARD size_type available() const { return (SIZE - sz);       } // Available entries
+
+    /*** Operators ***/
+    FlatMap& operator=(const FlatMap& sourceMap) &;
+    FlatMap& operator=(FlatMap&& sourceMap) & noexcept(std::is_nothrow_move_constructible_v<K> && std::is_nothrow_move_constructible_v<V>);
+
+private:
+    /*** Members ***/
+    Compare                                 compare;            // Ordering of the keys
+    ContainerDetail::SmallestIndex<SIZE>    sz{0};              // Number of entries
+    aligned_key                             keyData[SIZE];      // Sorted keys
+    aligned_value                           valueData[SIZE];    // Values in the order of the keys
+
+    /*** Helper functions ***/
+    NODISCARD const K*  key(const size_type slotIdx)    const   { return reinterpret_cast<const K*>(keyData + slotIdx);     }
+    NODISCARD K*        key(const size_type slotIdx)            { return reinterpret_cast<K*>(keyData + slotIdx);           }
+    NODISCARD const V*  value(const size_type slotIdx)  const   { return reinterpret_cast<const V*>(valueData + slotIdx);   }
+    NODISCARD V*        value(const size_type slotIdx)          { return reinterpret_cast<V*>(valueData + slotIdx);         }
+
+    NODISCARD size_type LowerBound(const key_type& searchKey) const; // First slot whose key is not less than the given one
+
+    NODISCARD bool Matches(const size_type slotIdx, const key_type& searchKey) const
+    {
+        return (slotIdx < sz) && !compare(searchKey, *key(slotIdx));
+    }
+};
+
+/**
+ * @brief Copy constructor
+ * @param copyMap   Source FlatMap for copying
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+FlatMap<K, V, SIZE, Compare>::FlatMap(const FlatMap& copyMap)
+    : compare(copyMap.compare)
+{
+    *this = copyMap;
+}
+
+/**
+ * @brief Move constructor
+ * @param moveMap   Source FlatMap for moving, it is left empty
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+FlatMap<K, V, SIZE, Compare>::FlatMap(FlatMap&& moveMap) noexcept(std::is_nothrow_move_constructible_v<K> && std::is_nothrow_move_constructible_v<V>)
+    : compare(moveMap.compare)
+{
+    *this = std::move(moveMap);
+}
+
+/**
+ * @brief Destructor
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+FlatMap<K, V, SIZE, Compare>::~FlatMap()
+{
+    clear();
+}
+
+/**
+ * @brief   Searches the value of the given key
+ * @param   searchKey   Key to be searched
+ * @return  Pointer to the value, nullptr if the key is not found
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+const V* FlatMap<K, V, SIZE, Compare>::find(const key_type& searchKey) const
+{
+    const size_type slotIdx = LowerBound(searchKey);
+
+    return Matches(slotIdx, searchKey) ? value(slotIdx) : nullptr;
+}
+
+/**
+ * @brief   Searches the value of the given key
+ * @param   searchKey   Key to be searched
+ * @return  Pointer to the value, nullptr if the key is not found
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+V* FlatMap<K, V, SIZE, Compare>::find(const key_type& searchKey)
+{
+    const size_type slotIdx = LowerBound(searchKey);
+
+    return Matches(slotIdx, searchKey) ? value(slotIdx) : nullptr;
+}
+
+/**
+ * @brief   Inserts a new entry by constructing its value in-place with the given arguments
+ * @param   newKey  Key of the new entry
+ * @param   args    Arguments to be forwarded to the constructor of the value
+ * @return  true    If the entry is inserted
+ *          false   If the key already exists or the FlatMap was full
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+template <class... Args>
+bool FlatMap<K, V, SIZE, Compare>::emplace(const key_type& newKey, Args&&... args)
+{
+    const size_type slotIdx = LowerBound(newKey);
+
+    if(full() || Matches(slotIdx, newKey))
+        return false;
+
+    // Shift the following entries to keep the keys sorted
+    ContainerDetail::OpenGap(key(0), slotIdx, sz);
+    ContainerDetail::OpenGap(value(0), slotIdx, sz);
+
+    new(keyData + slotIdx) key_type(newKey);
+    new(valueData + slotIdx) mapped_type(std::forward<Args>(args)...);
+
+    ++sz;
+
+    return true;
+}
+
+/**
+ * @brief   Inserts a new entry
+ * @param   newKey      Key of the new entry
+ * @param   newValue    Constant lValue reference to the value to be copied
+ * @return  true    If the entry is inserted
+ *          false   If the key already exists or the FlatMap was full
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+bool FlatMap<K, V, SIZE, Compare>::insert(const key_type& newKey, const mapped_type& newValue)
+{
+    return emplace(newKey, newValue);
+}
+
+/**
+ * @brief   Inserts a new entry
+ * @param   newKey      Key of the new entry
+ * @param   newValue    rValue reference to the value to be moved
+ * @return  true    If the entry is inserted
+ *          false   If the key already exists or the FlatMap was full
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+bool FlatMap<K, V, SIZE, Compare>::insert(const key_type& newKey, mapped_type&& newValue)
+{
+    return emplace(newKey, std::move(newValue));
+}
+
+/**
+ * @brief   Inserts a new entry or assigns the value of the existing one
+ * @param   newKey      Key of the entry
+ * @param   newValue    Value to be forwarded
+ * @return  true    If the entry is inserted or assigned
+ *          false   If the key does not exist and the FlatMap was full
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+template <class M>
+bool FlatMap<K, V, SIZE, Compare>::insert_or_assign(const key_type& newKey, M&& newValue)
+{
+    if(mapped_type* const existing = find(newKey))
+    {
+        *existing = std::forward<M>(newValue);
+
+        return true;
+    }
+
+    return emplace(newKey, std::forward<M>(newValue));
+}
+
+/**
+ * @brief   Removes the entry of the given key
+ * @param   oldKey  Key of the entry to be removed
+ * @return  true    If the entry is removed
+ *          false   If the key is not found
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+bool FlatMap<K, V, SIZE, Compare>::erase(const key_type& oldKey)
+{
+    const size_type slotIdx = LowerBound(oldKey);
+
+    if(!Matches(slotIdx, oldKey))
+        return false;
+
+    // Shift the following entries over the removed one
+    ContainerDetail::CloseGap(key(0), slotIdx, sz);
+    ContainerDetail::CloseGap(value(0), slotIdx, sz);
+
+    --sz;
+
+    return true;
+}
+
+/**
+ * @brief   Removes all entries
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+void FlatMap<K, V, SIZE, Compare>::clear()
+{
+    // Compiles to nothing for trivially destructible types
+    ContainerDetail::DestroyRange(key(0), sz);
+    ContainerDetail::DestroyRange(value(0), sz);
+
+    sz = 0;
+}
+
+/**
+ * @brief   Copy assignment operator
+ * @param   sourceMap   FlatMap to be copied from
+ * @return  lValue reference to the left FlatMap to support cascaded operations
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+FlatMap<K, V, SIZE, Compare>& FlatMap<K, V, SIZE, Compare>::operator=(const FlatMap& sourceMap) &
+{
+    if(this == &sourceMap)  // Check self copy
+        return *this;
+
+    clear();
+
+    // Single memcpy per array for trivially copyable types
+    ContainerDetail::ConstructRange(key(0), sourceMap.key(0), sourceMap.sz);
+    ContainerDetail::ConstructRange(value(0), sourceMap.value(0), sourceMap.sz);
+
+    compare = sourceMap.compare;
+    sz      = sourceMap.sz;
+
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator
+ * @param   sourceMap   FlatMap to be moved from, it is left empty
+ * @return  lValue reference to the left FlatMap to support cascaded operations
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+FlatMap<K, V, SIZE, Compare>& FlatMap<K, V, SIZE, Compare>::operator=(FlatMap&& sourceMap) & noexcept(std::is_nothrow_move_constructible_v<K> && std::is_nothrow_move_constructible_v<V>)
+{
+    if(this == &sourceMap)  // Check self move
+        return *this;
+
+    clear();
+
+    // Single memcpy per array for trivially copyable types
+    ContainerDetail::RelocateRange(key(0), sourceMap.key(0), sourceMap.sz);
+    ContainerDetail::RelocateRange(value(0), sourceMap.value(0), sourceMap.sz);
+
+    compare         = sourceMap.compare;
+    sz              = sourceMap.sz;
+    sourceMap.sz    = 0;
+
+    return *this;
+}
+
+/**
+ * @brief   Binary search of the given key
+ * @param   searchKey   Key to be searched
+ * @return  First slot whose key is not less than the searched one, size() if there is none
+ */
+template<class K, class V, std::size_t SIZE, class Compare>
+std::size_t FlatMap<K, V, SIZE, Compare>::LowerBound(const key_type& searchKey) const
+{
+    size_type first = 0, count = sz;
+
+    while(0 != count)
+    {
+        const size_type half = count / 2;
+
+        if(compare(*key(first + half), searchKey))
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+
+    return first;
+}
+
+/*** Read-only Container Class ***/
+/**
+ * @brief   Read-only sorted map which is built at compile time
+ * @note    Keys and values must be literal types with constexpr default construction.
+ * @note    Keys must be unique, duplicates fail the compile time construction.
+ */
+template<class K, class V, std::size_t SIZE, class Compare = std::less<K>>
+class ConstFlatMap{
+    static_assert(SIZE != 0, "ConstFlatMap capacity cannot be zero!");
+
+public:
+    using key_type          = K;
+    using mapped_type       = V;
+    using key_compare       = Compare;
+    using size_type         = std::size_t;
+
+    /**
+     * @brief   Constructor which sorts the given entries by their keys
+     * @param   entries     Key and value pairs in any order
+     */
+    constexpr explicit ConstFlatMap(const std::pair<K, V> (&entries)[SIZE])
+    {
+        for(size_type index = 0; index < SIZE; ++index)
+        {
+            keyData[index]      = entries[index].first;
+            valueData[index]    = entries[index].second;
+        }
+
+        // Insertion sort, the tables are small and it is constexpr friendly
+        for(size_type index = 1; index < SIZE; ++index)
+        {
+            const K movedKey    = keyData[index];
+            const V movedValue  = valueData[index];
+            size_type hole      = index;
+
+            for( ; (0 != hole) && Compare()(movedKey, keyData[hole - 1]); --hole)
+            {
+                keyData[hole]   = keyData[hole - 1];
+                valueData[hole] = valueData[hole - 1];
+            }
+
+            keyData[hole]   = movedKey;
+            valueData[hole] = movedValue;
+        }
+
+        for(size_type index = 1; index < SIZE; ++index)
+        {
+            if(!Compare()(keyData[index - 1], keyData[index]))
+                ContainerDetail::DuplicateKeyInConstantTable();
+        }
+    }
+
+    /*** Lookup ***/
+    NODISCARD constexpr const mapped_type* find(const key_type& searchKey) const
+    {
+        const size_type slotIdx = LowerBound(searchKey);
+
+        return ((slotIdx < SIZE) && !Compare()(searchKey, keyData[slotIdx])) ? (valueData + slotIdx) : nullptr;
+    }
+
+    NODISCARD constexpr bool contains(const key_type& searchKey) const { return (nullptr != find(searchKey)); }
+
+    /*** Element Access ***/
+    NODISCARD constexpr Span<const key_type>    keys()      const { return Span<const key_type>(keyData, SIZE);       } // Sorted keys
+    NODISCARD constexpr Span<const mapped_type> values()    const { return Span<const mapped_type>(valueData, SIZE);  } // Values in the key order
+
+    /*** Status Checkers ***/
+    NODISCARD constexpr bool      empty()     const { return false; } // A table is never empty
+    NODISCARD constexpr size_type size()      const { return SIZE;  } // Number of entries
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(ConstFlatMap); } // Memory taken by an instance, including bookkeeping and padding
+
+private:
+    K keyData[SIZE]{};      // Sorted keys
+    V valueData[SIZE]{};    // Values in the order of the keys
+
+    NODISCARD constexpr size_type LowerBound(const key_type& searchKey) const
+    {
+        size_type first = 0, count = SIZE;
+
+        while(0 != count)
+        {
+            const size_type half = count / 2;
+
+            if(Compare()(keyData[first + half], searchKey))
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+            {
+                count = half;
+            }
+        }
+
+        return first;
+    }
+};
+
+/**
+ * @brief   Builds a read-only sorted map from a list of entries
+ * @param   entries     Key and value pairs in any order
+ * @return  Sorted map with an entry count deduced from the list
+ * @note    e.g. constexpr auto routes = MakeConstFlatMap<uint16_t, uint8_t>({{0x120, 1}, {0x100, 0}});
+ */
+template<class K, class V, class Compare = std::less<K>, std::size_t SIZE>
+constexpr ConstFlatMap<K, V, SIZE, Compare> MakeConstFlatMap(const std::pair<K, V> (&entries)[SIZE])
+{
+    return ConstFlatMap<K, V, SIZE, Compare>(entries);
+}
@@ -0,0 +1,621 @@
+/**
+ * @file        HashMapContainer.h
+ * @details     Template hash based associative containers for embedded systems.
+ *              The containers are implemented without any dynamic allocation feature.
+ *              Entries are stored with open addressing in a power-of-two number of buckets.
+ *              Robin Hood probing keeps the probe sequences short and evenly distributed:
+ *              an entry far from its home bucket takes the place of an entry closer to its own.
+ *              Removal shifts the following entries backwards, so there are no tombstones.
+ *              HashMap is modifiable at run time. ConstHashMap is built at compile time,
+ *              so a constexpr instance can be placed in flash as a read-only lookup table.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> footprint_bytes() added for memory budgets.
+ *
+ * @note        The bucket count is the next power of two of 1.25 times the capacity, so the load factor
+ *              stays below 0.8 even when the container is full.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t
+#include <utility>      // std::move, std::forward, std::swap, std::pair
+#include <type_traits>  // std::aligned_storage
+#include <functional>   // std::hash, std::equal_to
+#include <new>          // operator new
+#include "ContainerHelpers.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Hash Functions ***/
+/**
+ * @brief   Default hash of the hash maps
+ * @note    Integral and enumeration keys are hashed with a constexpr identity, which is
+ *          required by the compile time tables. The bits are mixed by the maps anyway.
+ */
+template<class K, class = void>
+struct DefaultHash : std::hash<K>{ };
+
+template<class K>
+struct DefaultHash<K, std::enable_if_t<std::is_integral_v<K> || std::is_enum_v<K>>>{
+    constexpr std::size_t operator()(const K key) const noexcept { return static_cast<std::size_t>(key); }
+};
+
+namespace ContainerDetail {
+
+/**
+ * @brief   Bucket bookkeeping shared by the hash maps
+ */
+template<std::size_t SIZE>
+struct HashBuckets{
+    static constexpr std::size_t Count()
+    {
+        std::size_t buckets = 2;
+
+        while(buckets < (SIZE + (SIZE + 3) / 4))
+            buckets *= 2;
+
+        return buckets;
+    }
+
+    static constexpr std::size_t COUNT  = Count();
+    static constexpr std::size_t MASK   = COUNT - 1;
+
+    static constexpr unsigned Bits()
+    {
+        unsigned bits = 0;
+
+        while((std::size_t{1} << bits) < COUNT)
+            ++bits;
+
+        return bits;
+    }
+
+    /**
+     * @brief   Maps a hash value to its home bucket
+     * @note    Fibonacci hashing: the multiplication spreads the low bits (e.g. sequential IDs)
+     *          over the high bits, which are taken as the bucket index.
+     */
+    static constexpr std::size_t Home(const std::size_t hash)
+    {
+        const std::uint32_t folded = static_cast<std::uint32_t>(hash ^ ((hash >> 16) >> 16));
+
+        return static_cast<std::size_t>(static_cast<std::uint32_t>(folded * 2654435769u) >> (32 - Bits()));
+    }
+
+    static constexpr std::size_t Next(const std::size_t bucket) { return ((bucket + 1) & MASK); }
+
+    // 0 marks an empty bucket, otherwise the distance from the home bucket plus one
+    using probe_type = SmallestIndex<COUNT>;
+};
+
+} // namespace ContainerDetail
+
+/*** Container Class ***/
+template<class K, class V, std::size_t SIZE, class Hash = DefaultHash<K>, class KeyEqual = std::equal_to<K>>
+class HashMap{
+    static_assert(SIZE != 0, "HashMap capacity cannot be zero!");
+
+    using buckets       = ContainerDetail::HashBuckets<SIZE>;
+    using probe_type    = typename buckets::probe_type;
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using key_type          = K;
+    using mapped_type       = V;
+    using hasher            = Hash;
+    using key_equal         = KeyEqual;
+    using difference_type   = std::ptrdiff_t;
+    using size_type         = std::size_t;
+
+    struct Entry{
+        template <class... Args>
+        explicit Entry(const key_type& newKey, Args&&... args) : key(newKey), value(std::forward<Args>(args)...) { /* No operation */ }
+
+        key_type    key;
+        mapped_type value;
+    };
+
+    using aligned_data      = typename std::aligned_storage<sizeof(Entry), alignof(Entry)>::type;
+
+    /*** Constructors and Destructor ***/
+    // Default constructor
+    HashMap() = default;
+
+    // Copy constructor
+    HashMap(const HashMap& copyMap);
+
+    // Move constructor
+    HashMap(HashMap&& moveMap) noexcept(std::is_nothrow_move_constructible_v<Entry>);
+
+    // Destructor
+    ~HashMap();
+
+    /*** Lookup ***/
+    NODISCARD const mapped_type*    find(const key_type& searchKey) const;
+    NODISCARD mapped_type*          find(const key_type& searchKey);
+    NODISCARD bool                  contains(const key_type& searchKey) const { return (nullptr != find(searchKey)); }
+
+    /*** Traversal ***/
+    template<class FunctionT>
+    void for_each(FunctionT&& function) const;  // Calls function(key, value) for each entry in bucket order
+    template<class FunctionT>
+    void for_each(FunctionT&& function);        // Calls function(key, value) for each entry in bucket order
+
+    /*** Modifiers ***/
+    template <class... Args>
+    bool emplace(const key_type& newKey, Args&&... args);
+    bool insert(const key_type& newKey, const mapped_type& newValue);
+    bool insert(const key_type& newKey, mapped_type&& newValue);
+    template <class M>
+    bool insert_or_assign(const key_type& newKey, M&& newValue);
+    bool erase(const key_type& oldKey);
+    void clear();
+
+    /*** Status Checkers ***/
+    NODISCARD bool      empty()         const { return (0     == sz);     } // true if the HashMap is empty
+    NODISCARD bool      full()          const { return (SIZE  == sz);     } // true if the HashMap is full
+    NODISCARD size_type size()          const { return sz;                } // Current number of entries
+    NODISCARD size_type capacity()      const { return SIZE;              } // Maximum number of entries
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(HashMap); } // Memory taken by an instance, including bookkeeping and padding
+    NODISCARD size_type available()     const { return (SIZE - sz);       } // Available entries
+    NODISCARD size_type bucket_count()  const { return buckets::COUNT;    } // Number of buckets
+
+    /*** Operators ***/
+    HashMap& operator=(const HashMap& sourceMap) &;
+    HashMap& operator=(HashMap&& sourceMap) & noexcept(std::is_nothrow_move_constructible_v<Entry>);
+
+private:
+    /*** Members ***/
+    ContainerDetail::SmallestIndex<SIZE>    sz{0};                      // Number of entries
+    probe_type                              probes[buckets::COUNT]{};   // Probe distance of each bucket
+    aligned_data                            data[buckets::COUNT];       // Entries
+
+    /*** Helper functions ***/
+    NODISCARD const Entry& at(const size_type bucket) const
+    {
+        return reinterpret_cast<const Entry&>(data[bucket]);
+    }
+
+    NODISCARD Entry& at(const size_type bucket)
+    {
+        return reinterpret_cast<Entry&>(data[bucket]);
+    }
+
+    NODISCARD size_type Home(const key_type& searchKey) const { return buckets::Home(Hash()(searchKey)); }
+    NODISCARD size_type Locate(const key_type& searchKey) const; // Bucket of the key, COUNT if not found
+};
+
+/**
+ * @brief Copy constructor
+ * @param copyMap   Source HashMap for copying
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+HashMap<K, V, SIZE, Hash, KeyEqual>::HashMap(const HashMap& copyMap)
+{
+    *this = copyMap;
+}
+
+/**
+ * @brief Move constructor
+ * @param moveMap   Source HashMap for moving, it is left empty
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+HashMap<K, V, SIZE, Hash, KeyEqual>::HashMap(HashMap&& moveMap) noexcept(std::is_nothrow_move_constructible_v<Entry>)
+{
+    *this = std::move(moveMap);
+}
+
+/**
+ * @brief Destructor
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+HashMap<K, V, SIZE, Hash, KeyEqual>::~HashMap()
+{
+    if constexpr(!std::is_trivially_destructible_v<Entry>)
+        clear();
+}
+
+/**
+ * @brief   Searches the value of the given key
+ * @param   searchKey   Key to be searched
+ * @return  Pointer to the value, nullptr if the key is not found
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+const V* HashMap<K, V, SIZE, Hash, KeyEqual>::find(const key_type& searchKey) const
+{
+    const size_type bucket = Locate(searchKey);
+
+    return (buckets::COUNT == bucket) ? nullptr : &at(bucket).value;
+}
+
+/**
+ * @brief   Searches the value of the given key
+ * @param   searchKey   Key to be searched
+ * @return  Pointer to the value, nullptr if the key is not found
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+V* HashMap<K, V, SIZE, Hash, KeyEqual>::find(const key_type& searchKey)
+{
+    const size_type bucket = Locate(searchKey);
+
+    return (buckets::COUNT == bucket) ? nullptr : &at(bucket).value;
+}
+
+/**
+ * @brief   Calls the given function for each entry
+ * @param   function    Callable invoked as function(const key_type&, const mapped_type&)
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+template<class FunctionT>
+void HashMap<K, V, SIZE, Hash, KeyEqual>::for_each(FunctionT&& function) const
+{
+    for(size_type bucket = 0; bucket < buckets::COUNT; ++bucket)
+    {
+        if(0 != probes[bucket])
+            function(at(bucket).key, at(bucket).value);
+    }
+}
+
+/**
+ * @brief   Calls the given function for each entry
+ * @param   function    Callable invoked as function(const key_type&, mapped_type&)
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+template<class FunctionT>
+void HashMap<K, V, SIZE, Hash, KeyEqual>::for_each(FunctionT&& function)
+{
+    for(size_type bucket = 0; bucket < buckets::COUNT; ++bucket)
+    {
+        if(0 != probes[bucket])
+            function(static_cast<const key_type&>(at(bucket).key), at(bucket).value);
+    }
+}
+
+/**
+ * @brief   Inserts a new entry by constructing its value with the given arguments
+ * @param   newKey  Key of the new entry
+ * @param   args    Arguments to be forwarded to the constructor of the value
+ * @return  true    If the entry is inserted
+ *          false   If the key already exists or the HashMap was full
+ * @note    The carried entry is swapped with each entry that is closer to its home bucket.
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+template <class... Args>
+bool HashMap<K, V, SIZE, Hash, KeyEqual>::emplace(const key_type& newKey, Args&&... args)
+{
+    if(full() || (buckets::COUNT != Locate(newKey)))
+        return false;
+
+    Entry       carried(newKey, std::forward<Args>(args)...);
+    size_type   distance = 1;
+
+    // The load factor is below 1, so an empty bucket is always found
+    for(size_type bucket = Home(newKey); ; bucket = buckets::Next(bucket), ++distance)
+    {
+        if(0 == probes[bucket])
+        {
+            new(data + bucket) Entry(std::move(carried));
+            probes[bucket] = static_cast<probe_type>(distance);
+
+            break;
+        }
+
+        // Rich entry gives its bucket to the poor one
+        if(probes[bucket] < distance)
+        {
+            using std::swap;
+            swap(carried.key, at(bucket).key);
+            swap(carried.value, at(bucket).value);
+
+            const size_type displaced = probes[bucket];
+            probes[bucket] = static_cast<probe_type>(distance);
+            distance = displaced;
+        }
+    }
+
+    ++sz;
+
+    return true;
+}
+
+/**
+ * @brief   Inserts a new entry
+ * @param   newKey      Key of the new entry
+ * @param   newValue    Constant lValue reference to the value to be copied
+ * @return  true    If the entry is inserted
+ *          false   If the key already exists or the HashMap was full
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+bool HashMap<K, V, SIZE, Hash, KeyEqual>::insert(const key_type& newKey, const mapped_type& newValue)
+{
+    return emplace(newKey, newValue);
+}
+
+/**
+ * @brief   Inserts a new entry
+ * @param   newKey      Key of the new entry
+ * @param   newValue    rValue reference to the value to be moved
+ * @return  true    If the entry is inserted
+ *          false   If the key already exists or the HashMap was full
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+bool HashMap<K, V, SIZE, Hash, KeyEqual>::insert(const key_type& newKey, mapped_type&& newValue)
+{
+    return emplace(newKey, std::move(newValue));
+}
+
+/**
+ * @brief   Inserts a new entry or assigns the value of the existing one
+ * @param   newKey      Key of the entry
+ * @param   newValue    Value to be forwarded
+ * @return  true    If the entry is inserted or assigned
+ *          false   If the key does not exist and the HashMap was full
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+template <class M>
+bool HashMap<K, V, SIZE, Hash, KeyEqual>::insert_or_assign(const key_type& newKey, M&& newValue)
+{
+    if(mapped_type* const existing = find(newKey))
+    {
+        *existing = std::forward<M>(newValue);
+
+        return true;
+    }
+
+    return emplace(newKey, std::forward<M>(newValue));
+}
+
+/**
+ * @brief   Removes the entry of the given key
+ * @param   oldKey  Key of the entry to be removed
+ * @return  true    If the entry is removed
+ *          false   If the key is not found
+ * @note    Following entries which are not at their home buckets are shifted backwards.
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+bool HashMap<K, V, SIZE, Hash, KeyEqual>::erase(const key_type& oldKey)
+{
+    size_type bucket = Locate(oldKey);
+
+    if(buckets::COUNT == bucket)
+        return false;
+
+    // Explicitly call the destructor as we used the placement new
+    at(bucket).~Entry();
+
+    for(size_type next = buckets::Next(bucket); probes[next] > 1; bucket = next, next = buckets::Next(next))
+    {
+        new(data + bucket) Entry(std::move(at(next)));
+        at(next).~Entry();
+
+        probes[bucket] = static_cast<probe_type>(probes[next] - 1);
+    }
+
+    probes[bucket] = 0;
+    --sz;
+
+    return true;
+}
+
+/**
+ * @brief   Removes all entries
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+void HashMap<K, V, SIZE, Hash, KeyEqual>::clear()
+{
+    for(size_type bucket = 0; bucket < buckets::COUNT; ++bucket)
+    {
+        if constexpr(!std::is_trivially_destructible_v<Entry>)
+        {
+            if(0 != probes[bucket])
+                at(bucket).~Entry();
+        }
+
+        probes[bucket] = 0;
+    }
+
+    sz = 0;
+}
+
+/**
+ * @brief   Copy assignment operator
+ * @param   sourceMap   HashMap to be copied from
+ * @return  lValue reference to the left HashMap to support cascaded operations
+ * @note    Entries keep their buckets as both maps use the same hash.
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+HashMap<K, V, SIZE, Hash, KeyEqual>& HashMap<K, V, SIZE, Hash, KeyEqual>::operator=(const HashMap& sourceMap) &
+{
+    if(this == &sourceMap)  // Check self copy
+        return *this;
+
+    clear();
+
+    for(size_type bucket = 0; bucket < buckets::COUNT; ++bucket)
+    {
+        if(0 != sourceMap.probes[bucket])
+            new(data + bucket) Entry(sourceMap.at(bucket));
+
+        probes[bucket] = sourceMap.probes[bucket];
+    }
+
+    sz = sourceMap.sz;
+
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator
+ * @param   sourceMap   HashMap to be moved from, it is left empty
+ * @return  lValue reference to the left HashMap to support cascaded operations
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+HashMap<K, V, SIZE, Hash, KeyEqual>& HashMap<K, V, SIZE, Hash, KeyEqual>::operator=(HashMap&& sourceMap) & noexcept(std::is_nothrow_move_constructible_v<Entry>)
+{
+    if(this == &sourceMap)  // Check self move
+        return *this;
+
+    clear();
+
+    for(size_type bucket = 0; bucket < buckets::COUNT; ++bucket)
+    {
+        if(0 != sourceMap.probes[bucket])
+        {
+            new(data + bucket) Entry(std::move(sourceMap.at(bucket)));
+            sourceMap.at(bucket).~Entry();
+        }
+
+        probes[bucket]              = sourceMap.probes[bucket];
+        sourceMap.probes[bucket]    = 0;
+    }
+
+    sz              = sourceMap.sz;
+    sourceMap.sz    = 0;
+
+    return *this;
+}
+
+/**
+ * @brief   Searches the bucket of the given key
+ * @param   searchKey   Key to be searched
+ * @return  Bucket of the key, bucket count if the key is not found
+ * @note    The search stops as soon as an entry closer to its home than the key would be is met.
+ */
+template<class K, class V, std::size_t SIZE, class Hash, class KeyEqual>
+std::size_t HashMap<K, V, SIZE, Hash, KeyEqual>::Locate(const key_type& searchKey) const
+{
+    size_type bucket = Home(searchKey);
+
+    for(size_type distance = 1; probes[bucket] >= distance; bucket = buckets::Next(bucket), ++distance)
+    {
+        if((probes[bucket] == distance) && KeyEqual()(at(bucket).key, searchKey))
+            return bucket;
+    }
+
+    return buckets::COUNT;
+}
+
+/*** Read-only Container Class ***/
+/**
+ * @brief   Read-only hash map which is built at compile time
+ * @note    Keys and values must be literal types with constexpr default construction,
+ *          and the hash must be constexpr (e.g. DefaultHash of an integral key).
+ * @note    Keys must be unique, duplicates fail the compile time construction.
+ */
+template<class K, class V, std::size_t SIZE, class Hash = DefaultHash<K>, class KeyEqual = std::equal_to<K>>
+class ConstHashMap{
+    static_assert(SIZE != 0, "ConstHashMap capacity cannot be zero!");
+
+    using buckets       = ContainerDetail::HashBuckets<SIZE>;
+    using probe_type    = typename buckets::probe_type;
+
+public:
+    using key_type          = K;
+    using mapped_type       = V;
+    using hasher            = Hash;
+    using key_equal         = KeyEqual;
+    using size_type         = std::size_t;
+
+    /**
+     * @brief   Constructor which places the given entries into their buckets
+     * @param   entries     Key and value pairs in any order
+     */
+    constexpr explicit ConstHashMap(const std::pair<K, V> (&entries)[SIZE])
+    {
+        for(size_type index = 0; index < SIZE; ++index)
+        {
+            if(buckets::COUNT != Locate(entries[index].first))
+                ContainerDetail::DuplicateKeyInConstantTable();
+
+            K           carriedKey      = entries[index].first;
+            V           carriedValue    = entries[index].second;
+            size_type   distance        = 1;
+
+            for(size_type bucket = buckets::Home(Hash()(carriedKey)); ; bucket = buckets::Next(bucket), ++distance)
+            {
+                if(0 == probes[bucket])
+                {
+                    keyData[bucket]     = carriedKey;
+                    valueData[bucket]   = carriedValue;
+                    probes[bucket]      = static_cast<probe_type>(distance);
+
+                    break;
+                }
+
+                // Rich entry gives its bucket to the poor one
+                if(probes[bucket] < distance)
+                {
+                    const K         displacedKey        = keyData[bucket];
+                    const V         displacedValue      = valueData[bucket];
+                    const size_type displacedDistance   = probes[bucket];
+
+                    keyData[bucket]     = carriedKey;
+                    valueData[bucket]   = carriedValue;
+                    probes[bucket]      = static_cast<probe_type>(distance);
+
+                    carriedKey      = displacedKey;
+                    carriedValue    = displacedValue;
+                    distance        = displacedDistance;
+                }
+            }
+        }
+    }
+
+    /*** Lookup ***/
+    NODISCARD constexpr const mapped_type* find(const key_type& searchKey) const
+    {
+        const size_type bucket = Locate(searchKey);
+
+        return (buckets::COUNT == bucket) ? nullptr : (valueData + bucket);
+    }
+
+    NODISCARD constexpr bool contains(const key_type& searchKey) const { return (nullptr != find(searchKey)); }
+
+    /*** Status Checkers ***/
+    NODISCARD constexpr bool      empty()         const { return false;           } // A table is never empty
+    NODISCARD constexpr size_type size()          const { return SIZE;            } // Number of entries
+    NODISCARD constexpr size_type bucket_count()  const { return buckets::COUNT;  } // Number of buckets
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(ConstHashMap); } // Memory taken by an instance, including bookkeeping and padding
+
+private:
+    K           keyData[buckets::COUNT]{};      // Keys
+    V           valueData[buckets::COUNT]{};    // Values
+    probe_type  probes[buckets::COUNT]{};       // Probe distance of each bucket
+
+    NODISCARD constexpr size_type Locate(const key_type& searchKey) const
+    {
+        size_type bucket = buckets::Home(Hash()(searchKey));
+
+        for(size_type distance = 1; probes[bucket] >= distance; bucket = buckets::Next(bucket), ++distance)
+        {
+            if((probes[bucket] == distance) && KeyEqual()(keyData[bucket], searchKey))
+                return bucket;
+        }
+
+        return buckets::COUNT;
+    }
+};
+
+/**
+ * @brief   Builds a read-only hash map from a list of entries
+ * @param   entries     Key and value pairs in any order
+ * @return  Hash map with an entry count deduced from the list
+ * @note    e.g. constexpr auto routes = MakeConstHashMap<uint16_t, uint8_t>({{0x120, 1}, {0x100, 0}});
+ */
+template<class K, class V, class Hash = DefaultHash<K>, class KeyEqual = std::equal_to<K>, std::size_t SIZE>
+constexpr ConstHashMap<K, V, SIZE, Hash, KeyEqual> MakeConstHashMap(const std::pair<K, V> (&entries)[SIZE])
+{
+    return ConstHashMap<K, V, SIZE, Hash, KeyEqual>(entries);
+}
@@ -0,0 +1,65 @@
+/**
+ * @file        MemoryBudget.h
+ * @details     Compile time memory budget checks for the statically allocated containers.
+ *              The footprint of each container type is summed per memory section and checked against
+ *              the section's budget with a static_assert, so an over-provisioned section fails to compile
+ *              with a readable message instead of failing at link time.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ * @note        Example usage:
+ *              using DtcmBudget = MemoryBudget<64 * 1024,
+ *                                              Instances<4, Queue<Frame, 32>>,
+ *                                              Stack<Context, 16>,
+ *                                              uint8_t[2048]>;                     // DMA buffer
+ *              static_assert(DtcmBudget::fits, "DTCM budget exceeded!");
+ *
+ *              DtcmBudget::used and DtcmBudget::remaining can be printed or checked as well.
+ *              The peak_size() reported by the UsageStats policy shows which capacities can be reduced.
+ * @note        Gaps left by the linker between objects of different alignments are not counted.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <type_traits>  // std::void_t
+
+/*** Budget Entries ***/
+/**
+ * @brief   COUNT instances of the same type
+ */
+template<std::size_t COUNT, class T>
+struct Instances{
+    static constexpr std::size_t footprint_bytes() noexcept { return COUNT * sizeof(T); }
+};
+
+namespace ContainerDetail {
+
+/**
+ * @brief   Footprint of a budget entry, footprint_bytes() for the containers and sizeof for any other type
+ */
+template<class T, class = void>
+inline constexpr std::size_t Footprint = sizeof(T);
+
+template<class T>
+inline constexpr std::size_t Footprint<T, std::void_t<decltype(T::footprint_bytes())>> = T::footprint_bytes();
+
+} // namespace ContainerDetail
+
+/*** Budget Check ***/
+/**
+ * @tparam  BUDGET      Size of the memory section in bytes
+ * @tparam  Entries     Types placed in the section, Instances<COUNT, T> for repeated ones
+ */
+template<std::size_t BUDGET, class... Entries>
+struct MemoryBudget{
+    static constexpr std::size_t budget     = BUDGET;
+    static constexpr std::size_t used       = (std::size_t(0) + ... + ContainerDetail::Footprint<Entries>);
+    static constexpr bool        fits       = (used <= BUDGET);
+    static constexpr std::size_t remaining  = fits ? (BUDGET - used) : 0;
+    static constexpr std::size_t overflow   = fits ? 0 : (used - BUDGET);
+};
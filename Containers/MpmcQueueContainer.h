@@ -0,0 +1,269 @@
+/**
+ * @file        MpmcQueueContainer.h
+ * @details     A template bounded multi-producer/multi-consumer queue container for embedded systems.
+ *              The container is implemented without any dynamic allocation feature.
+ *              Each storage slot carries a sequence number which tells whether the slot is ready
+ *              to be written or read at a given position (D. Vyukov's bounded MPMC queue).
+ *              Producers and consumers claim positions with a single compare-and-swap,
+ *              hence there is no lock and no convoy under burst load.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Layout policy added to avoid false sharing of the positions.
+ *                               -> footprint_bytes() added for memory budgets.
+ *                               -> Element operations on a claimed slot required to be noexcept.
+ *
+ * @note        The capacity must be a power of two so that the positions can wrap around safely.
+ * @note        A slot is claimed before its element is constructed or moved out, so these operations must not throw.
+ *              Otherwise the sequence of the slot would never advance and every later access to it would stall.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <utility>      // std::move, std::forward
+#include <type_traits>  // std::aligned_storage
+#include <new>          // operator new
+#include <atomic>       // std::atomic
+#include "ConcurrentLayout.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+template<class T, std::size_t SIZE, class LayoutT = DefaultConcurrentLayout>
+class MpmcQueue{
+    static_assert(SIZE != 0, "Queue capacity cannot be zero!");
+    static_assert(0 == (SIZE & (SIZE - 1)), "MPMC queue capacity must be a power of two!");
+    static_assert(std::is_nothrow_move_assignable_v<T>, "MPMC queue elements must be nothrow move assignable!");
+    static_assert(std::is_nothrow_destructible_v<T>, "MPMC queue elements must be nothrow destructible!");
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type        = T;
+    using reference         = T&;
+    using const_reference   = const T&;
+    using difference_type   = std::ptrdiff_t;
+    using size_type         = std::size_t;
+    using aligned_data      = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    /*** Constructors and Destructor ***/
+    // Default constructor
+    MpmcQueue();
+
+    // Concurrent containers are not copyable
+    MpmcQueue(const MpmcQueue&)             = delete;
+    MpmcQueue& operator=(const MpmcQueue&)  = delete;
+
+    // Destructor
+    ~MpmcQueue();
+
+    /*** Modifiers ***/
+    template <class... Args>
+    bool try_emplace(Args&&... args);
+    bool try_push(const value_type& value);
+    bool try_push(value_type&& value);
+    bool try_pop(value_type& value);
+
+    /*** Status Checkers ***/
+    NODISCARD bool      empty()     const { return (0     == size()); } // true if the Queue is empty
+    NODISCARD bool      full()      const { return (SIZE  == size()); } // true if the Queue is full
+    NODISCARD size_type size()      const;                              // Current size of the Queue
+    NODISCARD size_type capacity()  const { return SIZE;              } // Maximum capacity of the Queue
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(MpmcQueue); } // Memory taken by an instance, including bookkeeping and padding
+    NODISCARD size_type available() const { return (SIZE - size());   } // Available slots in Queue
+
+private:
+    static constexpr size_type MASK = SIZE - 1;
+
+    struct PositionLayout{     // Padding of the given layout without any cached index
+        static constexpr std::size_t lineSize       = LayoutT::lineSize;
+        static constexpr bool        cacheIndices   = false;
+    };
+
+    /*** Members ***/
+    /* Positions are shared by all producers or all consumers, hence there is
+     * nothing to cache. The layout policy only separates their cache lines. */
+    ContainerDetail::OwnedIndex<size_type, PositionLayout> enqueue;     // Next position to be claimed by a producer
+    ContainerDetail::OwnedIndex<size_type, PositionLayout> dequeue;     // Next position to be claimed by a consumer
+    std::atomic<size_type> sequences[SIZE];                             // Sequence number of each slot
+    aligned_data           data[SIZE];                                  // Stored data
+
+    /*** Helper functions ***/
+    NODISCARD reference at(const size_type position)
+    {
+        return reinterpret_cast<reference>(data[position & MASK]);
+    }
+
+    static difference_type Lag(const size_type sequence, const size_type position) // Wraparound safe difference
+    {
+        return static_cast<difference_type>(sequence - position);
+    }
+};
+
+/**
+ * @brief Default constructor
+ * @note  Slot i is initially ready to be written at position i
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+MpmcQueue<T, SIZE, LayoutT>::MpmcQueue()
+{
+    for(size_type slotIdx = 0; slotIdx < SIZE; ++slotIdx)
+        sequences[slotIdx].store(slotIdx, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Destructor
+ * @note    Calls the destructor of each element explicitly
+ * @note    The queue must not be accessed concurrently during destruction
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+MpmcQueue<T, SIZE, LayoutT>::~MpmcQueue()
+{
+    if constexpr(!std::is_trivially_destructible_v<T>)
+    {
+        const size_type last = enqueue.value.load(std::memory_order_relaxed);
+
+        for(size_type position = dequeue.value.load(std::memory_order_relaxed); position != last; ++position)
+            at(position).~value_type();
+    }
+}
+
+/**
+ * @brief   Pushes the element by constructing it in-place with the given arguments
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @return  true    If the operation is successful.
+ *          false   If the queue was full
+ * @note    Safe to be called from multiple producers concurrently
+ * @note    The constructor selected by the arguments must be noexcept
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+template <class... Args>
+bool MpmcQueue<T, SIZE, LayoutT>::try_emplace(Args&&... args)
+{
+    static_assert(std::is_nothrow_constructible_v<T, Args&&...>, "MPMC queue elements must be nothrow constructible from the arguments!");
+
+    size_type position = enqueue.value.load(std::memory_order_relaxed);
+
+    for(;;)
+    {
+        const size_type sequence = sequences[position & MASK].load(std::memory_order_acquire);
+        const difference_type lag = Lag(sequence, position);
+
+        if(0 == lag)            // Slot is free at this position, try to claim it
+        {
+            if(enqueue.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if(lag < 0)        // Slot still holds the element of the previous lap
+        {
+            return false;
+        }
+        else                    // Another producer claimed the position
+        {
+            position = enqueue.value.load(std::memory_order_relaxed);
+        }
+    }
+
+    // In-place construct element with the arguments at the claimed slot
+    new(&at(position)) value_type(std::forward<Args>(args)...);
+
+    // Publish the element to the consumers
+    sequences[position & MASK].store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief   Pushes the element to the Queue
+ * @param   value   Constant lValue reference to the object to be pushed
+ * @return  true    If the operation is successful.
+ *          false   If the queue was full
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+bool MpmcQueue<T, SIZE, LayoutT>::try_push(const value_type& value)
+{
+    return try_emplace(value);
+}
+
+/**
+ * @brief   Pushes the element to the Queue
+ * @param   value   rValue reference to the object to be pushed
+ * @return  true    If the operation is successful.
+ *          false   If the queue was full
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+bool MpmcQueue<T, SIZE, LayoutT>::try_push(value_type&& value)
+{
+    return try_emplace(std::move(value));
+}
+
+/**
+ * @brief   Pops the front element of the Queue
+ * @param   value   Destination to be move assigned with the popped element
+ * @return  true    If the operation is successful.
+ *          false   If the queue was empty
+ * @note    Safe to be called from multiple consumers concurrently
+ * @note    Explicitly calls the destructor of the popped element
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+bool MpmcQueue<T, SIZE, LayoutT>::try_pop(value_type& value)
+{
+    size_type position = dequeue.value.load(std::memory_order_relaxed);
+
+    for(;;)
+    {
+        const size_type sequence = sequences[position & MASK].load(std::memory_order_acquire);
+        const difference_type lag = Lag(sequence, position + 1);
+
+        if(0 == lag)            // Slot is published at this position, try to claim it
+        {
+            if(dequeue.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if(lag < 0)        // Slot is not published yet
+        {
+            return false;
+        }
+        else                    // Another consumer claimed the position
+        {
+            position = dequeue.value.load(std::memory_order_relaxed);
+        }
+    }
+
+    reference element = at(position);
+
+    value = std::move(element);
+    element.~value_type();
+
+    // Hand the slot to the producers of the next lap
+    sequences[position & MASK].store(position + SIZE, std::memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief   Returns the current number of elements
+ * @return  Number of elements in the Queue
+ * @note    The result is a snapshot when the queue is accessed concurrently.
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+std::size_t MpmcQueue<T, SIZE, LayoutT>::size() const
+{
+    const size_type dequeued = dequeue.value.load(std::memory_order_acquire);
+    const size_type enqueued = enqueue.value.load(std::memory_order_acquire);
+    const difference_type count = static_cast<difference_type>(enqueued - dequeued);
+
+    if(count < 0)
+        return 0;
+
+    return (static_cast<size_type>(count) > SIZE) ? SIZE : static_cast<size_type>(count);
+}
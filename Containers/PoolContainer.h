@@ -0,0 +1,242 @@
+/**
+ * @file        PoolContainer.h
+ * @details     A template fixed-size object pool for embedded systems.
+ *              The container is implemented without any dynamic allocation feature.
+ *              Objects are allocated and released in O(1) with an intrusive free list, which is
+ *              stored in the storage of the free slots. Hence, there is no fragmentation.
+ *              Pointers or RAII handles of the pooled objects can be passed through a Queue
+ *              instead of copying the objects themselves.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> footprint_bytes() added for memory budgets.
+ *
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t
+#include <utility>      // std::forward, std::swap
+#include <type_traits>  // std::aligned_storage
+#include <functional>   // std::less
+#include <new>          // operator new
+#include "ContainerHelpers.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+template<class T, std::size_t SIZE>
+class Pool{
+    static_assert(SIZE != 0, "Pool capacity cannot be zero!");
+
+    using index_type = ContainerDetail::SmallestIndex<SIZE>;   // SIZE is used as the end of the free list
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type        = T;
+    using reference         = T&;
+    using const_reference   = const T&;
+    using pointer           = T*;
+    using const_pointer     = const T*;
+    using difference_type   = std::ptrdiff_t;
+    using size_type         = std::size_t;
+    using aligned_data      = typename std::aligned_storage<(sizeof(T)  > sizeof(index_type))  ? sizeof(T)  : sizeof(index_type),
+                                                            (alignof(T) > alignof(index_type)) ? alignof(T) : alignof(index_type)>::type;
+
+    /*** RAII Handle ***/
+    class Handle{
+    public:
+        Handle() = default;
+        Handle(const Handle&)               = delete;
+        Handle& operator=(const Handle&)    = delete;
+        Handle(Handle&& other) noexcept                 : owner(other.owner), object(other.detach()) { /* No operation */ }
+        Handle& operator=(Handle&& other) noexcept      { if(this != &other) { reset(); owner = other.owner; object = other.detach(); } return *this; }
+        ~Handle()                                       { reset(); }
+
+        NODISCARD pointer   get()           const noexcept  { return object;            }
+        NODISCARD reference operator*()     const noexcept  { return *object;           }
+        NODISCARD pointer   operator->()    const noexcept  { return object;            }
+        explicit operator bool()            const noexcept  { return (nullptr != object); }
+
+        pointer detach() noexcept   { pointer detached = object; object = nullptr; return detached; }    // Gives up the ownership
+        void    reset()             { if(nullptr != object) owner->release(detach()); }                  // Releases the object
+
+    private:
+        friend class Pool;
+        Handle(Pool* const pool, const pointer pooled) noexcept : owner(pool), object(pooled) { /* No operation */ }
+
+        Pool*   owner{nullptr};     // Pool of the object
+        pointer object{nullptr};    // Owned object
+    };
+
+    /*** Constructors and Destructor ***/
+    // Default constructor
+    Pool() = default;
+
+    // Pooled objects are referred by their addresses, hence the pool cannot be copied or moved
+    Pool(const Pool&)               = delete;
+    Pool& operator=(const Pool&)    = delete;
+
+    // Destructor
+    ~Pool();
+
+    /*** Modifiers ***/
+    template <class... Args>
+    NODISCARD pointer emplace(Args&&... args);
+    template <class... Args>
+    NODISCARD Handle  make(Args&&... args);
+    bool release(pointer object);
+
+    /*** Lookup ***/
+    NODISCARD bool owns(const_pointer object) const;
+
+    /*** Status Checkers ***/
+    NODISCARD bool      empty()     const { return (0     == sz);     } // true if there is no allocated object
+    NODISCARD bool      full()      const { return (SIZE  == sz);     } // true if every slot is allocated
+    NODISCARD size_type size()      const { return sz;                } // Number of allocated objects
+    NODISCARD size_type capacity()  const { return SIZE;              } // Maximum number of objects
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(Pool); } // Memory taken by an instance, including bookkeeping and padding
+    NODISCARD size_type available() const { return (SIZE - sz);       } // Number of free slots
+
+private:
+    /*** Members ***/
+    index_type      sz{0};                  // Number of allocated objects
+    index_type      idxFree{SIZE};          // First slot of the free list
+    index_type      idxFresh{0};            // Slots starting from this one have never been allocated
+    std::uint32_t   liveMask[(SIZE + 31) / 32]{};   // Allocation state of each slot
+    aligned_data    data[SIZE];             // Stored data
+
+    /*** Helper functions ***/
+    NODISCARD bool IsLive(const size_type slotIdx) const    { return (0 != (liveMask[slotIdx / 32] & (std::uint32_t{1} << (slotIdx % 32)))); }
+    void SetLive(const size_type slotIdx)                   { liveMask[slotIdx / 32] |=  (std::uint32_t{1} << (slotIdx % 32)); }
+    void ClearLive(const size_type slotIdx)                 { liveMask[slotIdx / 32] &= ~(std::uint32_t{1} << (slotIdx % 32)); }
+
+    NODISCARD index_type& NextFree(const size_type slotIdx) // Free list link stored in a free slot
+    {
+        return reinterpret_cast<index_type&>(data[slotIdx]);
+    }
+
+    NODISCARD size_type SlotOf(const_pointer object) const
+    {
+        const auto offset = reinterpret_cast<const unsigned char*>(object) - reinterpret_cast<const unsigned char*>(data);
+
+        return static_cast<size_type>(offset) / sizeof(aligned_data);
+    }
+};
+
+/**
+ * @brief   Destructor
+ * @note    Calls the destructor of each allocated object explicitly
+ */
+template<class T, std::size_t SIZE>
+Pool<T, SIZE>::~Pool()
+{
+    if constexpr(!std::is_trivially_destructible_v<T>)
+    {
+        for(size_type slotIdx = 0; slotIdx < idxFresh; ++slotIdx)
+        {
+            if(IsLive(slotIdx))
+                reinterpret_cast<reference>(data[slotIdx]).~value_type();
+        }
+    }
+}
+
+/**
+ * @brief   Allocates a slot and constructs the object in-place with the given arguments
+ * @param   args    Arguments to be forwarded to the constructor of the new object
+ * @return  Pointer to the new object, nullptr if the pool was full
+ */
+template<class T, std::size_t SIZE>
+template <class... Args>
+T* Pool<T, SIZE>::emplace(Args&&... args)
+{
+    const bool reuse = (SIZE != idxFree);     // Released slots are preferred over the fresh ones
+
+    if(!reuse && (SIZE == idxFresh))
+        return nullptr;
+
+    const size_type  slotIdx    = reuse ? idxFree : idxFresh;
+    const index_type nextFree   = reuse ? NextFree(slotIdx) : idxFree;
+
+    // In-place construct the object over the free list link
+    pointer object = new(data + slotIdx) value_type(std::forward<Args>(args)...);
+
+    if(reuse)
+        idxFree = nextFree;
+    else
+        ++idxFresh;
+
+    SetLive(slotIdx);
+    ++sz;
+
+    return object;
+}
+
+/**
+ * @brief   Allocates an object owned by an RAII handle
+ * @param   args    Arguments to be forwarded to the constructor of the new object
+ * @return  Handle of the new object, which is empty if the pool was full
+ * @note    The object is released when the handle goes out of scope.
+ */
+template<class T, std::size_t SIZE>
+template <class... Args>
+typename Pool<T, SIZE>::Handle Pool<T, SIZE>::make(Args&&... args)
+{
+    return Handle(this, emplace(std::forward<Args>(args)...));
+}
+
+/**
+ * @brief   Destroys the object and returns its slot to the pool
+ * @param   object  Pointer returned by emplace(..)
+ * @return  true    If the object is released
+ *          false   If the object is not allocated from this pool or is already released
+ */
+template<class T, std::size_t SIZE>
+bool Pool<T, SIZE>::release(pointer object)
+{
+    if(!owns(object))
+        return false;
+
+    // Explicitly call the destructor as we used the placement new
+    object->~value_type();
+
+    const size_type slotIdx = SlotOf(object);
+
+    // Link the slot to the head of the free list
+    new(data + slotIdx) index_type(idxFree);
+    idxFree = static_cast<index_type>(slotIdx);
+
+    ClearLive(slotIdx);
+    --sz;
+
+    return true;
+}
+
+/**
+ * @brief   Checks whether the object is currently allocated from this pool
+ * @param   object  Pointer to be checked
+ * @return  true    If the pointer refers to a live object of this pool
+ */
+template<class T, std::size_t SIZE>
+bool Pool<T, SIZE>::owns(const_pointer object) const
+{
+    const void* const address = object;
+
+    // Pointers of unrelated objects are only comparable with std::less
+    if(std::less<const void*>()(address, data) || !std::less<const void*>()(address, data + SIZE))
+        return false;
+
+    const size_type slotIdx = SlotOf(object);
+
+    return (static_cast<const void*>(data + slotIdx) == address) && IsLive(slotIdx);
+}
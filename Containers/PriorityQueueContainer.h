@@ -0,0 +1,353 @@
+/**
+ * @file        PriorityQueueContainer.h
+ * @details     A template priority queue container for embedded systems.
+ *              The container is implemented without any dynamic allocation feature.
+ *              Elements are kept as an implicit d-ary heap in a contiguous storage, which gives
+ *              O(log n) insertion and removal and O(1) access to the top element.
+ *              A 4-ary heap halves the number of levels, and the children of a node are
+ *              adjacent in memory, so each level costs fewer cache misses at the expense of more comparisons.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> footprint_bytes() added for memory budgets.
+ *
+ * @note        As std::priority_queue, the top element is the greatest one with respect to the comparator.
+ *              Use std::greater<T> for a min-heap, e.g. for deadlines.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <utility>      // std::move, std::forward
+#include <type_traits>  // std::aligned_storage
+#include <functional>   // std::less
+#include <new>          // operator new
+#include "ContainerHelpers.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+/**
+ * @tparam  T           Element type
+ * @tparam  SIZE        Maximum number of elements
+ * @tparam  Compare     Strict weak ordering, the top element is the one that is not less than any other
+ * @tparam  ARITY       Number of children per heap node, 2 (binary heap) or 4
+ */
+template<class T, std::size_t SIZE, class Compare = std::less<T>, std::size_t ARITY = 2>
+class PriorityQueue{
+    static_assert(SIZE != 0, "PriorityQueue capacity cannot be zero!");
+    static_assert((2 == ARITY) || (4 == ARITY), "Heap arity must be 2 or 4!");
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type        = T;
+    using reference         = T&;
+    using const_reference   = const T&;
+    using value_compare     = Compare;
+    using difference_type   = std::ptrdiff_t;
+    using size_type         = std::size_t;
+    using aligned_data      = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    /*** Constructors and Destructor ***/
+    // Default constructor
+    explicit PriorityQueue(const Compare& comparator = Compare()) : compare(comparator) { /* No operation */ }
+
+    // Copy constructor
+    PriorityQueue(const PriorityQueue& copyPQ);
+
+    // Move constructor
+    PriorityQueue(PriorityQueue&& movePQ) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    // Destructor
+    ~PriorityQueue();
+
+    /*** Element Access ***/
+    NODISCARD const_reference top() const { return at(0); }  // Not valid if the PriorityQueue is empty
+
+    /*** Modifiers ***/
+    template <class... Args>
+    bool emplace(Args&&... args);
+    bool push(const value_type& value);
+    bool push(value_type&& value);
+    void pop();
+    void clear();
+
+    /*** Status Checkers ***/
+    NODISCARD bool      empty()     const { return (0     == sz);     } // true if the PriorityQueue is empty
+    NODISCARD bool      full()      const { return (SIZE  == sz);     } // true if the PriorityQueue is full
+    NODISCARD size_type size()      const { return sz;                } // Current size of the PriorityQueue
+    NODISCARD size_type capacity()  const { return SIZE;              } // Maximum capacity of the PriorityQueue
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(PriorityQueue); } // Memory taken by an instance, including bookkeeping and padding
+    NODISCARD size_type available() const { return (SIZE - sz);       } // Available slots in PriorityQueue
+
+    /*** Operators ***/
+    PriorityQueue& operator=(const PriorityQueue& sourcePQ) &;
+    PriorityQueue& operator=(PriorityQueue&& sourcePQ) & noexcept(std::is_nothrow_move_constructible_v<T>);
+
+private:
+    /*** Members ***/
+    Compare                                 compare;        // Ordering of the elements
+    ContainerDetail::SmallestIndex<SIZE>    sz{0};          // Number of elements
+    aligned_data                            data[SIZE];     // Heap ordered data
+
+    /*** Helper functions ***/
+    NODISCARD const_reference at(const size_type slotIdx) const
+    {
+        return reinterpret_cast<const_reference>(data[slotIdx]);
+    }
+
+    NODISCARD reference at(const size_type slotIdx)
+    {
+        return reinterpret_cast<reference>(data[slotIdx]);
+    }
+
+    NODISCARD const T* slot(const size_type slotIdx) const
+    {
+        return reinterpret_cast<const T*>(data + slotIdx);
+    }
+
+    NODISCARD T* slot(const size_type slotIdx)
+    {
+        return reinterpret_cast<T*>(data + slotIdx);
+    }
+
+    static size_type Parent(const size_type slotIdx)        { return (slotIdx - 1) / ARITY; }
+    static size_type FirstChild(const size_type slotIdx)    { return (ARITY * slotIdx) + 1; }
+
+    void SiftUp(value_type&& value);                // Places the new element starting from the end
+    void SiftDown(value_type&& value);              // Places the element starting from the top
+};
+
+/**
+ * @brief Copy constructor
+ * @param copyPQ    Source PriorityQueue for copying
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+PriorityQueue<T, SIZE, Compare, ARITY>::PriorityQueue(const PriorityQueue& copyPQ)
+    : compare(copyPQ.compare)
+{
+    *this = copyPQ;
+}
+
+/**
+ * @brief Move constructor
+ * @param movePQ    Source PriorityQueue for moving, it is left empty
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+PriorityQueue<T, SIZE, Compare, ARITY>::PriorityQueue(PriorityQueue&& movePQ) noexcept(std::is_nothrow_move_constructible_v<T>)
+    : compare(movePQ.compare)
+{
+    *this = std::move(movePQ);
+}
+
+/**
+ * @brief Destructor
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+PriorityQueue<T, SIZE, Compare, ARITY>::~PriorityQueue()
+{
+    // Compiles to nothing for trivially destructible types
+    ContainerDetail::DestroyRange(slot(0), sz);
+}
+
+/**
+ * @brief   Inserts the element by constructing it with the given arguments
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @return  true    If the operation is successful.
+ *          false   If the PriorityQueue was full
+ * @note    O(log n) moves, the element is constructed once and moved to its final slot.
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+template <class... Args>
+bool PriorityQueue<T, SIZE, Compare, ARITY>::emplace(Args&&... args)
+{
+    if(full())
+        return false;
+
+    SiftUp(value_type(std::forward<Args>(args)...));
+
+    return true;
+}
+
+/**
+ * @brief   Inserts the element to the PriorityQueue
+ * @param   value   Constant lValue reference to the object to be inserted
+ * @return  true    If the operation is successful.
+ *          false   If the PriorityQueue was full
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+bool PriorityQueue<T, SIZE, Compare, ARITY>::push(const value_type& value)
+{
+    return emplace(value);
+}
+
+/**
+ * @brief   Inserts the element to the PriorityQueue
+ * @param   value   rValue reference to the object to be inserted
+ * @return  true    If the operation is successful.
+ *          false   If the PriorityQueue was full
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+bool PriorityQueue<T, SIZE, Compare, ARITY>::push(value_type&& value)
+{
+    if(full())
+        return false;
+
+    SiftUp(std::move(value));
+
+    return true;
+}
+
+/**
+ * @brief   Removes the top element of the PriorityQueue
+ * @note    The last element is moved down from the top to its final slot with O(log n) moves.
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+void PriorityQueue<T, SIZE, Compare, ARITY>::pop()
+{
+    if(empty())
+        return;
+
+    --sz;
+
+    if(0 == sz)
+    {
+        at(0).~value_type();
+
+        return;
+    }
+
+    // The last element re-enters from the top, its slot becomes free
+    value_type last(std::move(at(sz)));
+    at(sz).~value_type();
+
+    SiftDown(std::move(last));
+}
+
+/**
+ * @brief   Removes all elements of the PriorityQueue
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+void PriorityQueue<T, SIZE, Compare, ARITY>::clear()
+{
+    ContainerDetail::DestroyRange(slot(0), sz);
+    sz = 0;
+}
+
+/**
+ * @brief   Copy assignment operator
+ * @param   sourcePQ    PriorityQueue to be copied from
+ * @return  lValue reference to the left PriorityQueue to support cascaded operations
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+PriorityQueue<T, SIZE, Compare, ARITY>& PriorityQueue<T, SIZE, Compare, ARITY>::operator=(const PriorityQueue& sourcePQ) &
+{
+    if(this == &sourcePQ)   // Check self copy
+        return *this;
+
+    clear();
+
+    // Heap order is kept as is, single memcpy for trivially copyable types
+    ContainerDetail::ConstructRange(slot(0), sourcePQ.slot(0), sourcePQ.sz);
+
+    compare = sourcePQ.compare;
+    sz      = sourcePQ.sz;
+
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator
+ * @param   sourcePQ    PriorityQueue to be moved from, it is left empty
+ * @return  lValue reference to the left PriorityQueue to support cascaded operations
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+PriorityQueue<T, SIZE, Compare, ARITY>& PriorityQueue<T, SIZE, Compare, ARITY>::operator=(PriorityQueue&& sourcePQ) & noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if(this == &sourcePQ)   // Check self move
+        return *this;
+
+    clear();
+
+    // Heap order is kept as is, single memcpy for trivially copyable types
+    ContainerDetail::RelocateRange(slot(0), sourcePQ.slot(0), sourcePQ.sz);
+
+    compare     = sourcePQ.compare;
+    sz          = sourcePQ.sz;
+    sourcePQ.sz = 0;
+
+    return *this;
+}
+
+/**
+ * @brief   Places a new element into the heap, starting from the slot after the last element
+ * @param   value   Element to be placed
+ * @note    Parents with a lower priority are moved down into the hole instead of being swapped.
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+void PriorityQueue<T, SIZE, Compare, ARITY>::SiftUp(value_type&& value)
+{
+    size_type hole = sz;
+
+    // The first move fills the uninitialized slot at the end
+    if((0 != hole) && compare(at(Parent(hole)), value))
+    {
+        new(data + hole) value_type(std::move(at(Parent(hole))));
+        hole = Parent(hole);
+
+        while((0 != hole) && compare(at(Parent(hole)), value))
+        {
+            at(hole) = std::move(at(Parent(hole)));
+            hole = Parent(hole);
+        }
+
+        at(hole) = std::move(value);
+    }
+    else
+    {
+        new(data + hole) value_type(std::move(value));
+    }
+
+    ++sz;
+}
+
+/**
+ * @brief   Places an element into the heap, starting from the top slot
+ * @param   value   Element to be placed, the top slot is overwritten
+ * @note    Children with a higher priority are moved up into the hole instead of being swapped.
+ */
+template<class T, std::size_t SIZE, class Compare, std::size_t ARITY>
+void PriorityQueue<T, SIZE, Compare, ARITY>::SiftDown(value_type&& value)
+{
+    size_type hole = 0;
+
+    for(size_type child = FirstChild(hole); child < sz; child = FirstChild(hole))
+    {
+        // Find the child with the highest priority
+        const size_type lastChild = (child + ARITY < sz) ? (child + ARITY) : sz;
+        size_type best = child;
+
+        for(++child; child < lastChild; ++child)
+        {
+            if(compare(at(best), at(child)))
+                best = child;
+        }
+
+        if(!compare(value, at(best)))
+            break;
+
+        at(hole) = std::move(at(best));
+        hole = best;
+    }
+
+    at(hole) = std::move(value);
+}
@@ -0,0 +1,245 @@
+/**
+ * @file        QueueBatcher.h
+ * @details     A template batching layer for the producer side of a Queue.
+ *              Elements are collected in a small local buffer and published to the Queue
+ *              in bulk. The consumer is notified once per published batch, on an empty to
+ *              non-empty transition or on a high-watermark crossing, instead of once per element.
+ *              Typical use is an ISR collecting received bytes and waking an RTOS task at the
+ *              end of the interrupt, where each notification may cause a context switch.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ * @note        The batcher is owned by the producer. Accesses to the underlying Queue during
+ *              flush() must be protected against the consumer as for any other Queue access.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <utility>      // std::move, std::forward
+#include <type_traits>  // std::aligned_storage
+#include <iterator>     // std::make_move_iterator
+#include <cstring>      // std::memmove
+#include <new>          // operator new
+#include "ContainerHelpers.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Notification Types ***/
+enum class QueueEvent{
+    BecameNonEmpty,     // The Queue was empty before the batch
+    HighWatermark       // The Queue size reached the watermark with the batch
+};
+
+/**
+ * @brief   Notification hook which does nothing, used when the consumer polls the Queue
+ */
+struct NoNotification{
+    void operator()(QueueEvent, std::size_t) const noexcept { /* No operation */ }
+};
+
+/*** Container Class ***/
+/**
+ * @tparam  QueueT      Queue to be fed, e.g. Queue<uint8_t, 256>
+ * @tparam  BATCH       Capacity of the local buffer
+ * @tparam  NotifierT   Callable invoked as notifier(QueueEvent, size of the Queue after the batch)
+ */
+template<class QueueT, std::size_t BATCH, class NotifierT = NoNotification>
+class QueueBatcher{
+    static_assert(BATCH != 0, "Batch capacity cannot be zero!");
+
+public:
+    using value_type        = typename QueueT::value_type;
+    using reference         = value_type&;
+    using const_reference   = const value_type&;
+    using pointer           = value_type*;
+    using size_type         = std::size_t;
+    using aligned_data      = typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type;
+
+    /*** Constructors and Destructor ***/
+    // Watermark defaults to the capacity of the Queue, so only the full Queue reports a crossing
+    explicit QueueBatcher(QueueT& target, const size_type watermark = 0, NotifierT notify = NotifierT());
+
+    // The batcher refers to its Queue, hence it cannot be copied
+    QueueBatcher(const QueueBatcher&)               = delete;
+    QueueBatcher& operator=(const QueueBatcher&)    = delete;
+
+    // Destructor
+    ~QueueBatcher();
+
+    /*** Modifiers ***/
+    template <class... Args>
+    bool emplace(Args&&... args);
+    bool push(const value_type& value);
+    bool push(value_type&& value);
+
+    size_type flush();
+
+    void set_watermark(const size_type watermark) { highWatermark = (0 == watermark) ? queue.capacity() : watermark; }
+
+    /*** Status Checkers ***/
+    NODISCARD bool      empty()     const { return (0     == staged); } // true if there is no pending element
+    NODISCARD bool      full()      const { return (BATCH == staged); } // true if the local buffer is full
+    NODISCARD size_type size()      const { return staged;            } // Number of pending elements
+    NODISCARD size_type capacity()  const { return BATCH;             } // Capacity of the local buffer
+    NODISCARD size_type watermark() const { return highWatermark;     } // Size that triggers a notification
+
+private:
+    /*** Members ***/
+    QueueT&         queue;              // Queue to be fed
+    NotifierT       notifier;           // Called once per published batch
+    size_type       highWatermark;      // Size of Queue that triggers a notification
+    size_type       staged{0};          // Number of pending elements
+    aligned_data    data[BATCH];        // Pending elements
+
+    /*** Helper functions ***/
+    NODISCARD pointer slot(const size_type slotIdx)
+    {
+        return reinterpret_cast<pointer>(data + slotIdx);
+    }
+
+    void Compact(size_type published); // Moves the unpublished elements to the beginning
+};
+
+/**
+ * @brief   Constructor
+ * @param   target      Queue to be fed
+ * @param   watermark   Size of Queue that triggers a high-watermark notification, 0 selects the capacity
+ * @param   notify      Notification hook
+ */
+template<class QueueT, std::size_t BATCH, class NotifierT>
+QueueBatcher<QueueT, BATCH, NotifierT>::QueueBatcher(QueueT& target, const size_type watermark, NotifierT notify)
+    : queue(target), notifier(std::move(notify)), highWatermark((0 == watermark) ? target.capacity() : watermark)
+{ /* No operation */ }
+
+/**
+ * @brief   Destructor
+ * @note    Pending elements are published, the ones not fitting into the Queue are destroyed.
+ */
+template<class QueueT, std::size_t BATCH, class NotifierT>
+QueueBatcher<QueueT, BATCH, NotifierT>::~QueueBatcher()
+{
+    flush();
+
+    ContainerDetail::DestroyRange(slot(0), staged);
+}
+
+/**
+ * @brief   Appends the element by constructing it in-place with the given arguments
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @return  true    If the operation is successful.
+ *          false   If both the local buffer and the Queue were full
+ * @note    A full local buffer is flushed to the Queue before appending.
+ */
+template<class QueueT, std::size_t BATCH, class NotifierT>
+template <class... Args>
+bool QueueBatcher<QueueT, BATCH, NotifierT>::emplace(Args&&... args)
+{
+    if(full() && (0 == flush()))
+        return false;
+
+    // In-place construct element with the arguments at the back
+    new(data + staged) value_type(std::forward<Args>(args)...);
+    ++staged;
+
+    return true;
+}
+
+/**
+ * @brief   Appends the element to the batch
+ * @param   value   Constant lValue reference to the object to be appended
+ * @return  true    If the operation is successful.
+ *          false   If both the local buffer and the Queue were full
+ */
+template<class QueueT, std::size_t BATCH, class NotifierT>
+bool QueueBatcher<QueueT, BATCH, NotifierT>::push(const value_type& value)
+{
+    return emplace(value);
+}
+
+/**
+ * @brief   Appends the element to the batch
+ * @param   value   rValue reference to the object to be appended
+ * @return  true    If the operation is successful.
+ *          false   If both the local buffer and the Queue were full
+ */
+template<class QueueT, std::size_t BATCH, class NotifierT>
+bool QueueBatcher<QueueT, BATCH, NotifierT>::push(value_type&& value)
+{
+    return emplace(std::move(value));
+}
+
+/**
+ * @brief   Publishes the pending elements to the Queue with a single bulk push
+ * @return  Number of published elements, which is limited by the available slots of the Queue
+ * @note    The unpublished elements are kept for the next flush.
+ * @note    The notifier is called at most once: on an empty to non-empty transition, otherwise
+ *          on a high-watermark crossing.
+ */
+template<class QueueT, std::size_t BATCH, class NotifierT>
+std::size_t QueueBatcher<QueueT, BATCH, NotifierT>::flush()
+{
+    if(empty())
+        return 0;
+
+    const size_type sizeBefore = queue.size();
+    size_type published;
+
+    // Trivially copyable elements are published with memcpy
+    if constexpr(std::is_trivially_copyable_v<value_type>)
+        published = queue.push_n(slot(0), staged);
+    else
+        published = queue.push_n(std::make_move_iterator(slot(0)), staged);
+
+    if(0 == published)
+        return 0;
+
+    ContainerDetail::DestroyRange(slot(0), published);
+    Compact(published);
+
+    const size_type sizeAfter = sizeBefore + published;
+
+    if(0 == sizeBefore)
+        notifier(QueueEvent::BecameNonEmpty, sizeAfter);
+    else if((sizeBefore < highWatermark) && (sizeAfter >= highWatermark))
+        notifier(QueueEvent::HighWatermark, sizeAfter);
+
+    return published;
+}
+
+/**
+ * @brief   Moves the unpublished elements to the beginning of the local buffer
+ * @param   published   Number of already published (and destroyed) elements at the beginning
+ */
+template<class QueueT, std::size_t BATCH, class NotifierT>
+void QueueBatcher<QueueT, BATCH, NotifierT>::Compact(const size_type published)
+{
+    const size_type remaining = staged - published;
+
+    if constexpr(std::is_trivially_copyable_v<value_type>)
+    {
+        if(0 != remaining)
+            std::memmove(static_cast<void*>(slot(0)), slot(published), remaining * sizeof(value_type));
+    }
+    else
+    {
+        // Destination slots are either published or already relocated, hence uninitialized
+        for(size_type index = 0; index < remaining; ++index)
+        {
+            new(data + index) value_type(std::move(*slot(published + index)));
+            slot(published + index)->~value_type();
+        }
+    }
+
+    staged = remaining;
+}
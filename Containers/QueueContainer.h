@@ -15,6 +15,20 @@
  *              July 17, 2021   -> lvalue ref-qualifier added to assignment operator.
  *                              -> Helper function at(..) added to avoid repetition of casting.
  *                              -> Swap issue fixed with manual swapping of the storage.
+ *              October 14, 2026 -> Index arithmetic moved to RingIndex helper.
+ *                               -> Mask based RingIndex specialization for power-of-two capacities.
+ *                               -> Bulk push_n(..) and pop_n(..) methods added.
+ *                               -> Zero-copy span access added for DMA transfers.
+ *                               -> Bulk copy, swap and destruction for trivial types.
+ *                               -> Self assignment issue fixed.
+ *                               -> Move constructor and move assignment operator added.
+ *                               -> Swap moves the elements without any swappable match.
+ *                               -> Index members narrowed to the smallest type holding the capacity.
+ *                               -> Overwriting push methods added for lossy streams.
+ *                               -> Wrap-aware random access iterators and segment view added.
+ *                               -> Optional usage statistics policy added.
+ *                               -> RingIndex operations at the opposite ends added for Deque.
+ *                               -> footprint_bytes() added for memory budgets.
  *
  * @note        Feel free to contact for questions, bugs or any other thing.
  * @copyright   No copyright.
@@ -28,6 +42,11 @@
 #include <utility>      // std::move, std::swap
 #include <type_traits>  // std::aligned_storage
 #include <new>          // operator new
+#include <algorithm>    // std::min
+#include <iterator>     // std::iterator_traits, std::distance
+#include "ContainerHelpers.h"
+#include "Span.h"
+#include "ContainerStats.h"
 
 /*** Special definitions ***/
 // If the C++ version is greater or equal to 2017xx
@@ -37,9 +56,217 @@
 #define NODISCARD
 #endif
 
-/*** Container Class ***/
+/*** Helper Classes ***/
+namespace ContainerDetail {
+
+/**
+ * @brief   Ring index bookkeeping for generic capacities
+ * @note    Indices are wrapped on each increment and the size is tracked separately.
+ * @note    Members are kept in the narrowest unsigned type that can hold the capacity.
+ */
+template<std::size_t SIZE, bool = (0 == (SIZE & (SIZE - 1)))>
+class RingIndex{
+public:
+    using size_type  = std::size_t;
+    using index_type = SmallestIndex<SIZE>;
+
+    NODISCARD size_type size()  const { return sz;                  } // Number of elements
+    NODISCARD size_type front() const { return idxFront;            } // Slot of the front element
+    NODISCARD size_type back()  const { return idxBack;             } // Slot of the back element
+    NODISCARD size_type next()  const { return Next(idxBack);       } // Slot after the back element
+    NODISCARD size_type prev()  const { return Prev(idxFront);      } // Slot before the front element
+
+    NODISCARD size_type slot(const size_type position) const // Slot of the element at the given position from front
+    {
+        const size_type index = idxFront + position;
+
+        return (index >= SIZE) ? (index - SIZE) : index;
+    }
+
+    void pushBack()     { IncrementIndex(idxBack);  ++sz; }
+    void popFront()     { IncrementIndex(idxFront); --sz; }
+    void rotate()       { IncrementIndex(idxBack);  IncrementIndex(idxFront); } // Oldest slot becomes the newest one
+    void pushFront()    { DecrementIndex(idxFront); ++sz; }
+    void popBack()      { DecrementIndex(idxBack);  --sz; }
+
+    void pushBack(const size_type count)    { AdvanceIndex(idxBack,  count); sz = static_cast<index_type>(sz + count); }
+    void popFront(const size_type count)    { AdvanceIndex(idxFront, count); sz = static_cast<index_type>(sz - count); }
+
+    void reset(const size_type count) // Elements are placed at the slots [0, count)
+    {
+        sz          = static_cast<index_type>(count);
+        idxFront    = 0;
+        idxBack     = static_cast<index_type>((0 == count) ? SIZE-1 : count-1);
+    }
+
+    void resize(const size_type count) // Front slot is kept, back slot is adjusted
+    {
+        sz      = static_cast<index_type>(count);
+        idxBack = static_cast<index_type>((0 == count) ? slot(SIZE-1) : slot(count-1));
+    }
+
+private:
+    index_type sz{0};           // General size
+    index_type idxFront{0};     // Index of the front element
+    index_type idxBack{SIZE-1}; // Index of the back element
+
+    static void IncrementIndex(index_type& index) // Increments any index by not violating the range
+    {
+        index = (SIZE-1 == index) ? 0 : index+1;
+    }
+
+    static void AdvanceIndex(index_type& index, const size_type count) // Advances any index by at most SIZE
+    {
+        const size_type advanced = index + count;
+
+        index = static_cast<index_type>((advanced >= SIZE) ? (advanced - SIZE) : advanced);
+    }
+
+    static void DecrementIndex(index_type& index) // Decrements any index by not violating the range
+    {
+        index = (0 == index) ? SIZE-1 : index-1;
+    }
+
+    static size_type Next(index_type index)
+    {
+        IncrementIndex(index);
+
+        return index;
+    }
+
+    static size_type Prev(index_type index)
+    {
+        DecrementIndex(index);
+
+        return index;
+    }
+};
+
+/**
+ * @brief   Ring index bookkeeping for power-of-two capacities
+ * @note    Indices are free-running and masked on access, the size is derived from their difference.
+ *          Unsigned wraparound of the indices is harmless as the capacity divides the index range.
+ * @note    Members are kept in the narrowest unsigned type that can hold the capacity.
+ */
+template<std::size_t SIZE>
+class RingIndex<SIZE, true>{
+public:
+    using size_type  = std::size_t;
+    using index_type = SmallestIndex<SIZE>;
+
+    NODISCARD size_type size()  const { return static_cast<index_type>(tail - head);    } // Number of elements
+    NODISCARD size_type front() const { return (head & MASK);                           } // Slot of the front element
+    NODISCARD size_type back()  const { return ((size_type{tail} - 1) & MASK);          } // Slot of the back element
+    NODISCARD size_type next()  const { return (tail & MASK);                           } // Slot after the back element
+    NODISCARD size_type prev()  const { return ((size_type{head} - 1) & MASK);          } // Slot before the front element
+
+    NODISCARD size_type slot(const size_type position) const // Slot of the element at the given position from front
+    {
+        return ((head + position) & MASK);
+    }
+
+    void pushBack()     { ++tail; }
+    void popFront()     { ++head; }
+    void rotate()       { ++tail; ++head; } // Oldest slot becomes the newest one
+    void pushFront()    { --head; }
+    void popBack()      { --tail; }
+
+    void pushBack(const size_type count)    { tail = static_cast<index_type>(tail + count); }
+    void popFront(const size_type count)    { head = static_cast<index_type>(head + count); }
+
+    void reset(const size_type count) // Elements are placed at the slots [0, count)
+    {
+        head = 0;
+        tail = static_cast<index_type>(count);
+    }
+
+    void resize(const size_type count) // Front slot is kept, back slot is adjusted
+    {
+        tail = static_cast<index_type>(head + count);
+    }
+
+private:
+    static constexpr size_type MASK = SIZE - 1;
+
+    index_type head{0}; // Free-running index of the front element
+    index_type tail{0}; // Free-running index after the back element
+};
+
+/**
+ * @brief   Random access iterator over the elements of a ring buffer, from front to back
+ * @note    The iterator keeps the front slot and the logical position, so it is as cheap as
+ *          an index based loop. The wraparound costs a compare or a mask per dereference.
+ */
 template<class T, std::size_t SIZE>
-class Queue{
+class RingIterator{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = std::remove_cv_t<T>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+    using size_type         = std::size_t;
+
+    RingIterator() = default;
+    RingIterator(pointer storage, const size_type frontSlot, const size_type pos) noexcept
+        : base(storage), front(frontSlot), position(pos) { /* No operation */ }
+
+    // Mutable iterators are convertible to the constant ones
+    template<class U, class = std::enable_if_t<std::is_same_v<const U, T>>>
+    RingIterator(const RingIterator<U, SIZE>& other) noexcept
+        : base(other.base), front(other.front), position(other.position) { /* No operation */ }
+
+    NODISCARD reference operator*()                             const { return base[Slot(position)];                          }
+    NODISCARD pointer   operator->()                            const { return base + Slot(position);                         }
+    NODISCARD reference operator[](const difference_type offset) const { return base[Slot(position + offset)];                }
+
+    RingIterator& operator++()                                  { ++position; return *this;                                 }
+    RingIterator& operator--()                                  { --position; return *this;                                 }
+    RingIterator  operator++(int)                               { RingIterator prev = *this; ++position; return prev;       }
+    RingIterator  operator--(int)                               { RingIterator prev = *this; --position; return prev;       }
+    RingIterator& operator+=(const difference_type offset)      { position += offset; return *this;                         }
+    RingIterator& operator-=(const difference_type offset)      { position -= offset; return *this;                         }
+
+    NODISCARD RingIterator operator+(const difference_type offset) const { return RingIterator(base, front, position + offset); }
+    NODISCARD RingIterator operator-(const difference_type offset) const { return RingIterator(base, front, position - offset); }
+    NODISCARD friend RingIterator operator+(const difference_type offset, const RingIterator& it) { return it + offset; }
+
+    NODISCARD difference_type operator-(const RingIterator& other) const
+    {
+        return static_cast<difference_type>(position) - static_cast<difference_type>(other.position);
+    }
+
+    // Only the iterators of the same container are comparable
+    NODISCARD bool operator==(const RingIterator& other) const { return (position == other.position); }
+    NODISCARD bool operator!=(const RingIterator& other) const { return (position != other.position); }
+    NODISCARD bool operator< (const RingIterator& other) const { return (position <  other.position); }
+    NODISCARD bool operator> (const RingIterator& other) const { return (position >  other.position); }
+    NODISCARD bool operator<=(const RingIterator& other) const { return (position <= other.position); }
+    NODISCARD bool operator>=(const RingIterator& other) const { return (position >= other.position); }
+
+private:
+    template<class, std::size_t> friend class RingIterator;
+
+    pointer   base{nullptr};    // Beginning of the storage
+    size_type front{0};         // Slot of the front element
+    size_type position{0};      // Position from the front element
+
+    NODISCARD size_type Slot(const size_type pos) const // Positions are never beyond the capacity
+    {
+        const size_type index = front + pos;
+
+        if constexpr(0 == (SIZE & (SIZE - 1)))
+            return (index & (SIZE - 1));
+        else
+            return (index >= SIZE) ? (index - SIZE) : index;
+    }
+};
+
+} // namespace ContainerDetail
+
+/*** Container Class ***/
+template<class T, std::size_t SIZE, class StatsT = NoStats>
+class Queue : private StatsT::template Tracker<SIZE>{
     static_assert(SIZE != 0, "Queue capacity cannot be zero!");
 
 public:
@@ -47,11 +274,14 @@ public:
     using value_type        = T;
     using reference         = T&;
     using const_reference   = const T&;
-    using iterator          = T*;
-    using const_iterator    = const T*;
+    using pointer           = T*;
+    using const_pointer     = const T*;
+    using iterator          = ContainerDetail::RingIterator<T, SIZE>;
+    using const_iterator    = ContainerDetail::RingIterator<const T, SIZE>;
     using difference_type   = std::ptrdiff_t;
     using size_type         = std::size_t;
     using aligned_data      = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+    using stats_type        = typename StatsT::template Tracker<SIZE>;
 
     /*** Constructors and Destructor ***/
     // Default constructor
@@ -60,6 +290,9 @@ public:
     // Copy Constructor
     Queue(const Queue& copyQ);
 
+    // Move Constructor
+    Queue(Queue&& moveQ) noexcept(std::is_nothrow_move_constructible_v<T>);
+
     // Destructor
     ~Queue();
 
@@ -69,40 +302,71 @@ public:
     NODISCARD const_reference back() const;
     NODISCARD reference       back();
 
+    NODISCARD Span<const value_type>  read_span() const;
+    NODISCARD Span<value_type>        read_span();
+    NODISCARD Span<value_type>        write_span();
+
+    NODISCARD SpanPair<const value_type>  segments() const;
+    NODISCARD SpanPair<value_type>        segments();
+
+    /*** Iterators ***/
+    NODISCARD const_iterator begin()    const   { return const_iterator(slot(0), indices.front(), 0);      }
+    NODISCARD const_iterator end()      const   { return const_iterator(slot(0), indices.front(), size()); }
+    NODISCARD iterator       begin()            { return iterator(slot(0), indices.front(), 0);            }
+    NODISCARD iterator       end()              { return iterator(slot(0), indices.front(), size());       }
+    NODISCARD const_iterator cbegin()   const   { return begin();                                          }
+    NODISCARD const_iterator cend()     const   { return end();                                            }
+
     /*** Modifiers ***/
     template <class... Args>
     bool emplace(Args&&... args);
     bool push(const value_type& value);
     bool push(value_type&& value);
 
+    template <class... Args>
+    bool emplace_overwrite(Args&&... args);
+    bool push_overwrite(const value_type& value);
+    bool push_overwrite(value_type&& value);
+
+    template<class InputIt>
+    size_type push_n(InputIt source, size_type count);
+    template<class InputIt>
+    size_type push_n(InputIt first, InputIt last);
+
     void pop();
-    void swap(Queue& swapQ);
+    template<class OutputIt>
+    size_type pop_n(OutputIt destination, size_type count);
+    template<class OutputIt>
+    size_type pop_n(OutputIt first, OutputIt last);
+
+    void commit_write(size_type count);
+    void consume(size_type count);
+
+    void swap(Queue& swapQ) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>);
 
     /*** Status Checkers ***/
-    NODISCARD bool      empty()     const { return (0     == sz); } // true if the Queue is empty
-    NODISCARD bool      full()      const { return (SIZE  == sz); } // true if the Queue is full
-    NODISCARD size_type size()      const { return sz;            } // Current size of the Queue
-    NODISCARD size_type capacity()  const { return SIZE;          } // Maximum capacity of the Queue
-    NODISCARD size_type available() const { return (SIZE - sz);   } // Available slots in Queue
+    NODISCARD bool      empty()     const { return (0     == size()); } // true if the Queue is empty
+    NODISCARD bool      full()      const { return (SIZE  == size()); } // true if the Queue is full
+    NODISCARD size_type size()      const { return indices.size();    } // Current size of the Queue
+    NODISCARD size_type capacity()  const { return SIZE;              } // Maximum capacity of the Queue
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(Queue); } // Memory taken by an instance, including bookkeeping and padding
+    NODISCARD size_type available() const { return (SIZE - size());   } // Available slots in Queue
+
+    /*** Statistics ***/
+    NODISCARD const stats_type& stats() const { return *this; }        // Usage statistics, empty for NoStats
 
     /*** Operators ***/
     bool operator==(const Queue& compQ) const;
     bool operator!=(const Queue& compQ) const;
     Queue& operator=(const Queue& sourceQ) &;
+    Queue& operator=(Queue&& sourceQ) & noexcept(std::is_nothrow_move_constructible_v<T>);
 
 private:
     /*** Members ***/
-    size_type    sz;            // General size
-    size_type    idxFront;      // Index of the front element
-    size_type    idxBack;       // Index of the back element
-    aligned_data data[SIZE];    // Stored data
+    ContainerDetail::RingIndex<SIZE> indices;   // Front, back and size bookkeeping
+    aligned_data data[SIZE];                    // Stored data
 
     /*** Helper functions ***/
-    static void IncrementIndex(size_type& index) // Increments any index by not violating the range
-    {
-        index = (SIZE-1 == index) ? 0 : index+1;
-    }
-
     NODISCARD const_reference at(const size_type elemIdx) const
     {
         return reinterpret_cast<const_reference>(data[elemIdx]);
@@ -112,75 +376,167 @@ private:
     {
         return reinterpret_cast<reference>(data[elemIdx]);
     }
+
+    void MoveFrom(Queue& sourceQ) noexcept(std::is_nothrow_move_constructible_v<T>);
+    void Discard(size_type count);     // Destroys the front elements without updating the statistics
+
+    NODISCARD stats_type& Tracker() { return *this; }
+
+    NODISCARD const_pointer slot(const size_type slotIdx) const
+    {
+        return reinterpret_cast<const_pointer>(data + slotIdx);
+    }
+
+    NODISCARD pointer slot(const size_type slotIdx)
+    {
+        return reinterpret_cast<pointer>(data + slotIdx);
+    }
 };
 
 /**
  * @brief Default constructor
  */
-template<class T, std::size_t SIZE>
-Queue<T,SIZE>::Queue()
-    : sz(0), idxFront(0), idxBack(SIZE-1)
+template<class T, std::size_t SIZE, class StatsT>
+Queue<T, SIZE, StatsT>::Queue()
+    : indices()
 { /* No operation */ }
 
 /**
  * @brief Copy constructor
  */
-template<class T, std::size_t SIZE>
-Queue<T,SIZE>::Queue(const Queue& copyQ)
-    : sz(0), idxFront(0), idxBack(SIZE-1)
+template<class T, std::size_t SIZE, class StatsT>
+Queue<T, SIZE, StatsT>::Queue(const Queue& copyQ)
+    : indices()
 {
     *this = copyQ;
 }
 
+/**
+ * @brief   Move constructor
+ * @param   moveQ   Queue to be moved from, it is left empty
+ */
+template<class T, std::size_t SIZE, class StatsT>
+Queue<T, SIZE, StatsT>::Queue(Queue&& moveQ) noexcept(std::is_nothrow_move_constructible_v<T>)
+    : indices()
+{
+    MoveFrom(moveQ);
+}
+
 /**
  * @brief   Destructor
  * @note    Calls the destructor of each element explicitly
  */
-template<class T, std::size_t SIZE>
-Queue<T,SIZE>::~Queue()
+template<class T, std::size_t SIZE, class StatsT>
+Queue<T, SIZE, StatsT>::~Queue()
 {
-    while(!empty())
-        pop();
+    // Nothing to be done for trivially destructible types
+    if constexpr(!std::is_trivially_destructible_v<T>)
+        Discard(size());
 }
 
 /**
  * @brief   Returns a constant lValue reference to the front element of Queue
  * @return  Constant lValue reference to the front element
  */
-template<class T, std::size_t SIZE>
-const T& Queue<T, SIZE>::front() const
+template<class T, std::size_t SIZE, class StatsT>
+const T& Queue<T, SIZE, StatsT>::front() const
 {
-    return at(idxFront);
+    return at(indices.front());
 }
 
 /**
  * @brief   Returns an lValue reference to the front element of Queue
  * @return  lValue reference to the front element
  */
-template<class T, std::size_t SIZE>
-T& Queue<T, SIZE>::front()
+template<class T, std::size_t SIZE, class StatsT>
+T& Queue<T, SIZE, StatsT>::front()
 {
-    return at(idxFront);
+    return at(indices.front());
 }
 
 /**
  * @brief   Returns a constant lValue reference to the back element of Queue
  * @return  Constant lValue reference to the back element
  */
-template<class T, std::size_t SIZE>
-const T& Queue<T, SIZE>::back() const
+template<class T, std::size_t SIZE, class StatsT>
+const T& Queue<T, SIZE, StatsT>::back() const
 {
-    return at(idxBack);
+    return at(indices.back());
 }
 
 /**
  * @brief   Returns an lValue reference to the back element of Queue
  * @return  lValue reference to the back element
  */
-template<class T, std::size_t SIZE>
-T& Queue<T, SIZE>::back()
+template<class T, std::size_t SIZE, class StatsT>
+T& Queue<T, SIZE, StatsT>::back()
 {
-    return at(idxBack);
+    return at(indices.back());
+}
+
+/**
+ * @brief   Returns the largest contiguous readable region at the front of the Queue
+ * @return  Constant view over the front elements till the end of the storage or the back element
+ * @note    The rest of the elements, if any, are at the beginning of the storage.
+ *          They become readable after consuming the returned region.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+Span<const T> Queue<T, SIZE, StatsT>::read_span() const
+{
+    return Span<const value_type>(slot(indices.front()), std::min(size(), SIZE - indices.front()));
+}
+
+/**
+ * @brief   Returns the largest contiguous readable region at the front of the Queue
+ * @return  View over the front elements till the end of the storage or the back element
+ * @note    The rest of the elements, if any, are at the beginning of the storage.
+ *          They become readable after consuming the returned region.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+Span<T> Queue<T, SIZE, StatsT>::read_span()
+{
+    return Span<value_type>(slot(indices.front()), std::min(size(), SIZE - indices.front()));
+}
+
+/**
+ * @brief   Returns the largest contiguous writable region at the back of the Queue
+ * @return  View over the free slots till the end of the storage or the front element
+ * @note    The region is uninitialized storage, so it is restricted to trivially copyable types.
+ *          Written elements become part of the Queue once they are committed with commit_write(..).
+ * @note    Intended for peripherals (e.g. DMA) writing directly into the storage.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+Span<T> Queue<T, SIZE, StatsT>::write_span()
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Raw writes require a trivially copyable type!");
+
+    return Span<value_type>(slot(indices.next()), std::min(available(), SIZE - indices.next()));
+}
+
+/**
+ * @brief   Returns the elements of the Queue as two contiguous regions
+ * @return  Constant views over the front region and the wrapped region at the beginning of the storage
+ * @note    The second region is empty if the elements do not wrap around.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+SpanPair<const T> Queue<T, SIZE, StatsT>::segments() const
+{
+    const Span<const value_type> firstChunk = read_span();
+
+    return { firstChunk, Span<const value_type>(slot(0), size() - firstChunk.size()) };
+}
+
+/**
+ * @brief   Returns the elements of the Queue as two contiguous regions
+ * @return  Views over the front region and the wrapped region at the beginning of the storage
+ * @note    The second region is empty if the elements do not wrap around.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+SpanPair<T> Queue<T, SIZE, StatsT>::segments()
+{
+    const Span<value_type> firstChunk = read_span();
+
+    return { firstChunk, Span<value_type>(slot(0), size() - firstChunk.size()) };
 }
 
 /**
@@ -189,20 +545,23 @@ T& Queue<T, SIZE>::back()
  * @return  true    If the operation is successful.
  *          false   If the queue was full
  */
-template<class T, std::size_t SIZE>
+template<class T, std::size_t SIZE, class StatsT>
 template <class... Args>
-bool Queue<T, SIZE>::emplace(Args&&... args)
+bool Queue<T, SIZE, StatsT>::emplace(Args&&... args)
 {
     if(full())
-        return false;
+    {
+        Tracker().OnPushFailed();
 
-    // Adjust back index
-    IncrementIndex(idxBack);
+        return false;
+    }
 
     // In-place construct element with the arguments at the back
-    new(data + idxBack) value_type(std::forward<Args>(args)...);
+    new(data + indices.next()) value_type(std::forward<Args>(args)...);
 
-    ++sz;   // Increment size
+    // Adjust back index and size
+    indices.pushBack();
+    Tracker().OnPush(indices.back(), 1, size());
 
     return true;
 }
@@ -213,19 +572,22 @@ bool Queue<T, SIZE>::emplace(Args&&... args)
  * @return  true    If the operation is successful.
  *          false   If the queue was full
  */
-template<class T, std::size_t SIZE>
-bool Queue<T, SIZE>::push(const value_type& value)
+template<class T, std::size_t SIZE, class StatsT>
+bool Queue<T, SIZE, StatsT>::push(const value_type& value)
 {
     if(full())
-        return false;
+    {
+        Tracker().OnPushFailed();
 
-    // Adjust back index
-    IncrementIndex(idxBack);
+        return false;
+    }
 
     // Copy construct element at the back
-    new(data + idxBack) value_type(value);
+    new(data + indices.next()) value_type(value);
 
-    ++sz;   // Increment size
+    // Adjust back index and size
+    indices.pushBack();
+    Tracker().OnPush(indices.back(), 1, size());
 
     return true;
 }
@@ -236,83 +598,329 @@ bool Queue<T, SIZE>::push(const value_type& value)
  * @return  true    If the operation is successful.
  *          false   If the queue was full
  */
-template<class T, std::size_t SIZE>
-bool Queue<T, SIZE>::push(value_type&& value)
+template<class T, std::size_t SIZE, class StatsT>
+bool Queue<T, SIZE, StatsT>::push(value_type&& value)
 {
     return emplace(std::move(value));
 }
 
+/**
+ * @brief   Pushes the element constructed with the given arguments, overwriting the oldest one if the Queue is full
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @return  true    If the oldest element is overwritten
+ *          false   If there was an available slot
+ * @note    The new element is move assigned over the oldest one, no destructor is called.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+template <class... Args>
+bool Queue<T, SIZE, StatsT>::emplace_overwrite(Args&&... args)
+{
+    if(!full())
+        return !emplace(std::forward<Args>(args)...);
+
+    Tracker().OnPop(indices.front(), 1);
+
+    at(indices.front()) = value_type(std::forward<Args>(args)...);
+
+    // Front and back are advanced together, the size is kept
+    indices.rotate();
+    Tracker().OnPush(indices.back(), 1, size());
+
+    return true;
+}
+
+/**
+ * @brief   Pushes the element, overwriting the oldest one if the Queue is full
+ * @param   value   Constant lValue reference to the object to be pushed
+ * @return  true    If the oldest element is overwritten
+ *          false   If there was an available slot
+ * @note    The element is copy assigned over the oldest one, no destructor is called.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+bool Queue<T, SIZE, StatsT>::push_overwrite(const value_type& value)
+{
+    if(!full())
+        return !push(value);
+
+    Tracker().OnPop(indices.front(), 1);
+
+    at(indices.front()) = value;
+
+    // Front and back are advanced together, the size is kept
+    indices.rotate();
+    Tracker().OnPush(indices.back(), 1, size());
+
+    return true;
+}
+
+/**
+ * @brief   Pushes the element, overwriting the oldest one if the Queue is full
+ * @param   value   rValue reference to the object to be pushed
+ * @return  true    If the oldest element is overwritten
+ *          false   If there was an available slot
+ * @note    The element is move assigned over the oldest one, no destructor is called.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+bool Queue<T, SIZE, StatsT>::push_overwrite(value_type&& value)
+{
+    if(!full())
+        return !push(std::move(value));
+
+    Tracker().OnPop(indices.front(), 1);
+
+    at(indices.front()) = std::move(value);
+
+    // Front and back are advanced together, the size is kept
+    indices.rotate();
+    Tracker().OnPush(indices.back(), 1, size());
+
+    return true;
+}
+
+/**
+ * @brief   Pushes multiple elements to the Queue
+ * @param   source  Iterator to the first element to be copied
+ * @param   count   Number of elements to be pushed
+ * @return  Number of elements pushed, which is limited by the available slots
+ * @note    Elements are copied in at most two contiguous chunks.
+ *          A single memcpy is used per chunk if the elements are trivially copyable.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+template<class InputIt>
+std::size_t Queue<T, SIZE, StatsT>::push_n(InputIt source, size_type count)
+{
+    if(count > available())
+    {
+        Tracker().OnPushFailed();
+        count = available();
+    }
+
+    const size_type firstSlot = indices.next();
+
+    // Chunk until the end of the storage
+    const size_type chunk = std::min(count, SIZE - firstSlot);
+
+    source = ContainerDetail::ConstructRange(slot(indices.next()), source, chunk);
+    indices.pushBack(chunk);
+
+    // Wrapped chunk from the beginning of the storage
+    ContainerDetail::ConstructRange(slot(indices.next()), source, count - chunk);
+    indices.pushBack(count - chunk);
+
+    Tracker().OnPush(firstSlot, count, size());
+
+    return count;
+}
+
+/**
+ * @brief   Pushes the elements in the given range to the Queue
+ * @param   first   Iterator to the first element to be copied
+ * @param   last    Iterator after the last element to be copied
+ * @return  Number of elements pushed, which is limited by the available slots
+ */
+template<class T, std::size_t SIZE, class StatsT>
+template<class InputIt>
+std::size_t Queue<T, SIZE, StatsT>::push_n(InputIt first, InputIt last)
+{
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+
+    // Multi-pass ranges can be measured beforehand
+    if constexpr(std::is_base_of_v<std::forward_iterator_tag, category>)
+    {
+        return push_n(first, static_cast<size_type>(std::distance(first, last)));
+    }
+    else
+    {
+        size_type count = 0;
+
+        for( ; (first != last) && emplace(*first); ++first)
+            ++count;
+
+        return count;
+    }
+}
+
 /**
  * @brief   Pops the front element of the Queue
  * @note    Explicitly calls the destructor of the popped element
  */
-template<class T, std::size_t SIZE>
-void Queue<T, SIZE>::pop()
+template<class T, std::size_t SIZE, class StatsT>
+void Queue<T, SIZE, StatsT>::pop()
 {
-    if(!empty())
+    if(empty())
     {
-        // Explicitly call the destructor as we used the placement new
-        at(idxFront).~value_type();
-
-        IncrementIndex(idxFront);
+        Tracker().OnPopEmpty();
 
-        // Decrement size
-        --sz;
+        return;
     }
+
+    Tracker().OnPop(indices.front(), 1);
+
+    // Explicitly call the destructor as we used the placement new
+    at(indices.front()).~value_type();
+
+    // Adjust front index and size
+    indices.popFront();
+}
+
+/**
+ * @brief   Pops multiple elements from the front of the Queue
+ * @param   destination     Iterator to the first element to be assigned
+ * @param   count           Number of elements to be popped
+ * @return  Number of elements popped, which is limited by the size of the Queue
+ * @note    Elements are moved out in at most two contiguous chunks.
+ *          A single memcpy is used per chunk if the elements are trivially copyable.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+template<class OutputIt>
+std::size_t Queue<T, SIZE, StatsT>::pop_n(OutputIt destination, size_type count)
+{
+    if((0 != count) && empty())
+        Tracker().OnPopEmpty();
+
+    count = std::min(count, size());
+    Tracker().OnPop(indices.front(), count);
+
+    // Chunk until the end of the storage
+    const size_type chunk = std::min(count, SIZE - indices.front());
+
+    destination = ContainerDetail::MoveOutRange(slot(indices.front()), chunk, destination);
+    indices.popFront(chunk);
+
+    // Wrapped chunk from the beginning of the storage
+    ContainerDetail::MoveOutRange(slot(indices.front()), count - chunk, destination);
+    indices.popFront(count - chunk);
+
+    return count;
+}
+
+/**
+ * @brief   Pops elements from the front of the Queue into the given range
+ * @param   first   Iterator to the first element to be assigned
+ * @param   last    Iterator after the last element to be assigned
+ * @return  Number of elements popped, which is limited by the size of the Queue
+ */
+template<class T, std::size_t SIZE, class StatsT>
+template<class OutputIt>
+std::size_t Queue<T, SIZE, StatsT>::pop_n(OutputIt first, OutputIt last)
+{
+    return pop_n(first, static_cast<size_type>(std::distance(first, last)));
+}
+
+/**
+ * @brief   Appends the elements written into the region returned by write_span()
+ * @param   count   Number of elements written
+ * @note    The count is limited by the available slots.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+void Queue<T, SIZE, StatsT>::commit_write(const size_type count)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Raw writes require a trivially copyable type!");
+
+    const size_type firstSlot = indices.next(), committed = std::min(count, available());
+
+    indices.pushBack(committed);
+    Tracker().OnPush(firstSlot, committed, size());
+}
+
+/**
+ * @brief   Removes elements from the front of the Queue after reading them in-place
+ * @param   count   Number of elements to be removed
+ * @note    The count is limited by the size of the Queue.
+ * @note    Explicitly calls the destructor of each removed element
+ */
+template<class T, std::size_t SIZE, class StatsT>
+void Queue<T, SIZE, StatsT>::consume(size_type count)
+{
+    if((0 != count) && empty())
+        Tracker().OnPopEmpty();
+
+    count = std::min(count, size());
+    Tracker().OnPop(indices.front(), count);
+
+    Discard(count);
+}
+
+/**
+ * @brief   Destroys elements at the front of the Queue
+ * @param   count   Number of elements to be destroyed, must not exceed the size
+ * @note    Used while replacing the whole content, so the statistics are not updated.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+void Queue<T, SIZE, StatsT>::Discard(const size_type count)
+{
+    // Chunk until the end of the storage
+    const size_type chunk = std::min(count, SIZE - indices.front());
+
+    ContainerDetail::DestroyRange(slot(indices.front()), chunk);
+    indices.popFront(chunk);
+
+    // Wrapped chunk from the beginning of the storage
+    ContainerDetail::DestroyRange(slot(indices.front()), count - chunk);
+    indices.popFront(count - chunk);
 }
 
 /**
  * @brief Swaps the content of two Queues
  * @param swapQ     Queue to be swapped with
  */
-template<class T, std::size_t SIZE>
-void Queue<T, SIZE>::swap(Queue& swapQ)
+template<class T, std::size_t SIZE, class StatsT>
+void Queue<T, SIZE, StatsT>::swap(Queue& swapQ) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>)
 {
-    size_type swapIdx0 = idxFront, swapIdx1 = swapQ.idxFront, swapCount = 0;
-
-    // Swap the matching elements
-    for( ; (swapCount < sz) && (swapCount < swapQ.sz); ++swapCount)
+    // Trivially copyable elements are exchanged along with the raw storage
+    if constexpr(std::is_trivially_copyable_v<T>)
     {
-        std::swap(at(swapIdx0), swapQ.at(swapIdx1));
+        std::swap_ranges(data, data + SIZE, swapQ.data);
+        std::swap(indices, swapQ.indices);
 
-        IncrementIndex(swapIdx0);
-        IncrementIndex(swapIdx1);
+        Tracker().OnPush(indices.front(), size(), size());
+        swapQ.Tracker().OnPush(swapQ.indices.front(), swapQ.size(), swapQ.size());
+
+        return;
     }
 
+    const size_type size0 = size(), size1 = swapQ.size();
+    size_type swapCount = 0;
+
+    // Swap the matching elements
+    for( ; (swapCount < size0) && (swapCount < size1); ++swapCount)
+        std::swap(at(indices.slot(swapCount)), swapQ.at(swapQ.indices.slot(swapCount)));
+
     // Move the elements without any swappable match
-    if(sz > swapQ.sz)
+    if(size0 > size1)
     {
-        for( ; swapCount < sz; ++swapCount)
+        for( ; swapCount < size0; ++swapCount)
         {
+            const size_type swapIdx0 = indices.slot(swapCount), swapIdx1 = swapQ.indices.slot(swapCount);
+
             // Construct element at new Queue
-            new(swapQ.data + swapIdx1) value_type(at(swapIdx0));
+            new(swapQ.data + swapIdx1) value_type(std::move(at(swapIdx0)));
 
             // Remove element from previous Queue
             at(swapIdx0).~value_type();
-
-            IncrementIndex(swapIdx0);
-            IncrementIndex(swapIdx1);
         }
     }
-    else if(sz < swapQ.sz)
+    else if(size0 < size1)
     {
-        for( ; swapCount < swapQ.sz; ++swapCount)
+        for( ; swapCount < size1; ++swapCount)
         {
+            const size_type swapIdx0 = indices.slot(swapCount), swapIdx1 = swapQ.indices.slot(swapCount);
+
             // Construct element at new Queue
-            new(data + swapIdx0) value_type(swapQ.at(swapIdx1));
+            new(data + swapIdx0) value_type(std::move(swapQ.at(swapIdx1)));
 
             // Remove element from previous Queue
-            at(swapIdx1).~value_type();
-
-            IncrementIndex(swapIdx0);
-            IncrementIndex(swapIdx1);
+            swapQ.at(swapIdx1).~value_type();
         }
     }
 
-    // Swap indexes
-    std::swap(idxBack,  swapQ.idxBack);
-    std::swap(idxFront, swapQ.idxFront);
-    std::swap(sz,       swapQ.sz);
+    // Each Queue keeps its front index while the sizes are exchanged
+    indices.resize(size1);
+    swapQ.indices.resize(size0);
+
+    // Taken over elements are treated as pushed by now
+    Tracker().OnPush(indices.front(), size(), size());
+    swapQ.Tracker().OnPush(swapQ.indices.front(), swapQ.size(), swapQ.size());
 }
 
 /**
@@ -320,21 +928,17 @@ void Queue<T, SIZE>::swap(Queue& swapQ)
  * @param   compQ   Queue to be compared with.
  * @return  true    If both Queues are equal.
  */
-template<class T, std::size_t SIZE>
-bool Queue<T, SIZE>::operator==(const Queue& compQ) const
+template<class T, std::size_t SIZE, class StatsT>
+bool Queue<T, SIZE, StatsT>::operator==(const Queue& compQ) const
 {
-    if(compQ.size() != sz)  // Size must be equal
+    if(compQ.size() != size())  // Size must be equal
         return false;
 
     // Element-wise comparison
-    size_type index0 = idxFront, index1 = compQ.idxFront;
     for(size_type elemIdx = 0; elemIdx < compQ.size(); ++elemIdx)
     {
-        if(compQ.at(index1) != at(index0))
+        if(compQ.at(compQ.indices.slot(elemIdx)) != at(indices.slot(elemIdx)))
             return false;
-
-        IncrementIndex(index0);
-        IncrementIndex(index1);
     }
 
     // Queues are equal if the function reaches here
@@ -346,8 +950,8 @@ bool Queue<T, SIZE>::operator==(const Queue& compQ) const
  * @param   compQ   Queue to be compared with.
  * @return  true    If Queues are not equal.
  */
-template<class T, std::size_t SIZE>
-bool Queue<T, SIZE>::operator!=(const Queue& compQ) const
+template<class T, std::size_t SIZE, class StatsT>
+bool Queue<T, SIZE, StatsT>::operator!=(const Queue& compQ) const
 {
     return !(compQ == *this);
 }
@@ -357,24 +961,62 @@ bool Queue<T, SIZE>::operator!=(const Queue& compQ) const
  * @param   sourceQ     Queue to be copied from
  * @return  lValue reference to the left Queue to support cascaded operations
  */
-template<class T, std::size_t SIZE>
-Queue<T, SIZE>& Queue<T, SIZE>::operator=(const Queue& sourceQ) &
+template<class T, std::size_t SIZE, class StatsT>
+Queue<T, SIZE, StatsT>& Queue<T, SIZE, StatsT>::operator=(const Queue& sourceQ) &
 {
+    if(this == &sourceQ)    // Check self copy
+        return *this;
+
     // Pop all elements first
-    while(!empty())
-        pop();
+    Discard(size());
 
-    if(!sourceQ.empty())
-    {
-        // Copy construct each element
-        size_type sourceIdx = sourceQ.idxFront;
-        for(size_type elemIdx = 0; elemIdx < sourceQ.sz; ++elemIdx, IncrementIndex(sourceIdx))
-            new(data + elemIdx) value_type(sourceQ.at(sourceIdx));
+    // Copy construct the elements in at most two contiguous chunks
+    const Span<const value_type> firstChunk = sourceQ.read_span();
 
-        idxFront    = 0;
-        idxBack     = sourceQ.sz - 1;
-        sz          = sourceQ.sz;
-    }
+    ContainerDetail::ConstructRange(slot(0), firstChunk.data(), firstChunk.size());
+    ContainerDetail::ConstructRange(slot(firstChunk.size()), sourceQ.slot(0), sourceQ.size() - firstChunk.size());
+
+    indices.reset(sourceQ.size());
+    Tracker().OnPush(indices.front(), size(), size());
 
     return *this;
 }
+
+/**
+ * @brief   Move assignment operator
+ * @param   sourceQ     Queue to be moved from, it is left empty
+ * @return  lValue reference to the left Queue to support cascaded operations
+ */
+template<class T, std::size_t SIZE, class StatsT>
+Queue<T, SIZE, StatsT>& Queue<T, SIZE, StatsT>::operator=(Queue&& sourceQ) & noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if(this == &sourceQ)    // Check self move
+        return *this;
+
+    // Pop all elements first
+    Discard(size());
+
+    MoveFrom(sourceQ);
+
+    return *this;
+}
+
+/**
+ * @brief   Relocates the elements of an empty Queue from another one
+ * @param   sourceQ     Queue to be moved from, it is left empty
+ * @note    Elements keep their storage slots, so the indices are taken over as is.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+void Queue<T, SIZE, StatsT>::MoveFrom(Queue& sourceQ) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    const size_type firstSlot   = sourceQ.indices.front();
+    const size_type firstChunk  = std::min(sourceQ.size(), SIZE - firstSlot);
+
+    ContainerDetail::RelocateRange(slot(firstSlot), sourceQ.slot(firstSlot), firstChunk);
+    ContainerDetail::RelocateRange(slot(0), sourceQ.slot(0), sourceQ.size() - firstChunk);
+
+    indices = sourceQ.indices;
+    sourceQ.indices.reset(0);
+
+    Tracker().OnPush(indices.front(), size(), size());
+}
@@ -0,0 +1,382 @@
+/**
+ * @file        SharedQueueContainer.h
+ * @details     A template single-producer/single-consumer queue to be placed in memory shared by two cores
+ *              of an asymmetric multi-processing (AMP) system, e.g. the Cortex-M7 and Cortex-M4 of an STM32H7.
+ *              The queue has a fixed, standard layout without any pointer, so both cores can map the same
+ *              object at the agreed address. Each index and the data region are placed on their own cache lines
+ *              and every write is followed by a clean, every read is preceded by an invalidate of the related lines.
+ *              Messages are written into and read from the shared slots in place (zero-copy).
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> footprint_bytes() added for memory budgets.
+ *                               -> Attach(..) invalidates the cached index lines of the attaching core.
+ *
+ * @note        Only one core may call the producer side methods (reserve, commit, emplace, push, full) and
+ *              only the other core may call the consumer side methods (peek, release, pop, empty).
+ * @note        The cores may instantiate the queue with different SharedMemoryT policies,
+ *              e.g. with cache maintenance on the M7 and without it on the M4. T, SIZE and LINE_SIZE must match.
+ * @note        The attaching core's view is resynchronised in Attach(..), any copy of the index lines it cached
+ *              before the creation (e.g. from the startup zeroing or a previous boot) is dropped there.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t
+#include <utility>      // std::forward
+#include <type_traits>  // std::aligned_storage
+#include <new>          // operator new
+#include <atomic>       // std::atomic
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Shared Memory Policies ***/
+/**
+ * @brief   Policy for a non-cacheable shared region (e.g. set by the MPU) or a core without data cache
+ * @note    A policy provides four static hooks. The cache hooks receive line aligned ranges only.
+ *          Example for the Cortex-M7 side with CMSIS and the hardware semaphore of the STM32H7:
+ *
+ *          struct M7SharedMemory{
+ *              static void Clean(const void* address, std::size_t size)        { SCB_CleanDCache_by_Addr((uint32_t*)address, size);      }
+ *              static void Invalidate(const void* address, std::size_t size)   { SCB_InvalidateDCache_by_Addr((uint32_t*)address, size); }
+ *              static void NotifyConsumer()                                    { HAL_HSEM_FastTake(HSEM_TX); HAL_HSEM_Release(HSEM_TX, 0); }
+ *              static void NotifyProducer()                                    { HAL_HSEM_FastTake(HSEM_RX); HAL_HSEM_Release(HSEM_RX, 0); }
+ *          };
+ */
+struct NoCacheMaintenance{
+    static void Clean(const void*, std::size_t) noexcept        { /* No operation */ }  // Write the lines back to the shared memory
+    static void Invalidate(const void*, std::size_t) noexcept   { /* No operation */ }  // Drop the local copy of the lines
+    static void NotifyConsumer() noexcept                       { /* No operation */ }  // Called after an element is published
+    static void NotifyProducer() noexcept                       { /* No operation */ }  // Called after a slot is handed back
+};
+
+/*** Container Class ***/
+/**
+ * @tparam  T               Element type, trivially copyable and free of pointers to core local data
+ * @tparam  SIZE            Maximum number of elements
+ * @tparam  SharedMemoryT   Cache maintenance and notification hooks of the calling core
+ * @tparam  LINE_SIZE       Largest data cache line size of the cores, 32 bytes on Cortex-M7
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT = NoCacheMaintenance, std::size_t LINE_SIZE = 32>
+class alignas(LINE_SIZE) SharedQueue{
+    static_assert(SIZE != 0, "Queue capacity cannot be zero!");
+    static_assert(2*SIZE <= UINT32_MAX, "Queue capacity exceeds the index range!");
+    static_assert(0 == (LINE_SIZE & (LINE_SIZE - 1)), "Cache line size must be a power of two!");
+    static_assert(std::is_trivially_copyable_v<T>, "Shared elements must be trivially copyable!");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "Shared indices must be lock-free!");
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type        = T;
+    using reference         = T&;
+    using const_reference   = const T&;
+    using difference_type   = std::ptrdiff_t;
+    using size_type         = std::size_t;
+    using index_type        = std::uint32_t;        // Fixed width, the cores may differ in their size_t
+    using aligned_data      = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    /*** Constructors and Destructor ***/
+    // Default constructor, must only be run by one of the cores
+    SharedQueue() noexcept;
+
+    // Shared objects are not copyable
+    SharedQueue(const SharedQueue&)             = delete;
+    SharedQueue& operator=(const SharedQueue&)  = delete;
+
+    // Constructs the queue at the given shared address, called by the core which owns the initialization
+    static SharedQueue& Create(void* const sharedAddress) noexcept;
+
+    // Returns the queue at the given shared address, called by the other core after the creation
+    NODISCARD static SharedQueue& Attach(void* const sharedAddress) noexcept;
+
+    /*** Producer Side ***/
+    NODISCARD T* reserve();                     // Slot for the next element, nullptr if the queue is full
+    void commit();                              // Publishes the reserved slot
+
+    template <class... Args>
+    bool emplace(Args&&... args);
+    bool push(const value_type& value);
+
+    NODISCARD bool full();
+
+    /*** Consumer Side ***/
+    NODISCARD const T* peek();                  // Front element in the shared memory, nullptr if the queue is empty
+    void release();                             // Hands the front slot back to the producer
+
+    bool pop(value_type& destination);
+
+    NODISCARD bool empty();
+
+    /*** Status Checkers ***/
+    NODISCARD constexpr size_type capacity() const noexcept { return SIZE; }   // Maximum capacity of the Queue
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(SharedQueue); } // Memory taken by an instance, including bookkeeping and padding
+
+private:
+    /*** Members ***/
+    /* Each line is written by a single core only, so invalidating a line never drops the other core's writes.
+     * Indices run over [0, 2*SIZE) so that a full queue can be distinguished from an empty one.
+     * Each side keeps the last observed index of the other side on its own line. */
+    struct alignas(LINE_SIZE) ProducerLine{
+        std::atomic<index_type> tail;           // Index after the back element
+        index_type              observedHead;   // Last consumer index read by the producer
+    };
+
+    struct alignas(LINE_SIZE) ConsumerLine{
+        std::atomic<index_type> head;           // Index of the front element
+        index_type              observedTail;   // Last producer index read by the consumer
+    };
+
+    ProducerLine                    producer;       // Written by the producer only
+    ConsumerLine                    consumer;       // Written by the consumer only
+    alignas(LINE_SIZE) aligned_data data[SIZE];     // Written by the producer only
+
+    /*** Helper functions ***/
+    static index_type NextIndex(const index_type index) // Increments any index by not violating the range
+    {
+        return (2*SIZE-1 == index) ? 0 : index+1;
+    }
+
+    static size_type Slot(const index_type index) // Converts an index to the storage slot
+    {
+        return (index < SIZE) ? index : index-SIZE;
+    }
+
+    static size_type Distance(const index_type head, const index_type tail) // Number of elements in between
+    {
+        return (tail >= head) ? (tail - head) : (tail + 2*SIZE - head);
+    }
+
+    NODISCARD T* SlotAddress(const index_type index)
+    {
+        return reinterpret_cast<T*>(data + Slot(index));
+    }
+
+    // Cache lines covering a slot, shared lines are harmless as the data region has a single writer
+    static const void* LineStart(const void* const address)
+    {
+        return reinterpret_cast<const void*>(reinterpret_cast<std::uintptr_t>(address) & ~std::uintptr_t(LINE_SIZE - 1));
+    }
+
+    static size_type LineSpan(const void* const address)
+    {
+        const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(address) & ~std::uintptr_t(LINE_SIZE - 1);
+        const std::uintptr_t last  = reinterpret_cast<std::uintptr_t>(address) + sizeof(T);
+
+        return static_cast<size_type>(((last - first) + LINE_SIZE - 1) & ~std::uintptr_t(LINE_SIZE - 1));
+    }
+};
+
+/**
+ * @brief   Default constructor
+ * @note    The indices are written back to the shared memory so that the other core observes an empty queue.
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::SharedQueue() noexcept
+    : producer{{0}, 0}, consumer{{0}, 0}
+{
+    static_assert(std::is_standard_layout_v<SharedQueue>, "Shared queue layout must be standard!");
+
+    SharedMemoryT::Clean(&producer, sizeof(producer));
+    SharedMemoryT::Clean(&consumer, sizeof(consumer));
+}
+
+/**
+ * @brief   Constructs the queue in the shared memory
+ * @param   sharedAddress   Address of the shared region, aligned to LINE_SIZE and at least sizeof(SharedQueue) long
+ * @return  lValue reference to the queue
+ * @note    Must be called once by a single core before the other core attaches to the queue.
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>& SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::Create(void* const sharedAddress) noexcept
+{
+    return *new(sharedAddress) SharedQueue();
+}
+
+/**
+ * @brief   Returns the queue constructed in the shared memory by the other core
+ * @param   sharedAddress   Address passed to Create(..) by the other core
+ * @return  lValue reference to the queue
+ * @note    Stale or dirty copies of the index lines held by the calling core are dropped,
+ *          so the indices are read from and later cleaned over the creator's initialised ones.
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>& SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::Attach(void* const sharedAddress) noexcept
+{
+    SharedQueue* const queue = std::launder(static_cast<SharedQueue*>(sharedAddress));
+
+    SharedMemoryT::Invalidate(&queue->producer, sizeof(queue->producer));
+    SharedMemoryT::Invalidate(&queue->consumer, sizeof(queue->consumer));
+
+    return *queue;
+}
+
+/**
+ * @brief   Returns the slot of the next element to be written in place
+ * @return  Pointer to the slot in the shared memory, nullptr if the queue is full
+ * @note    The element is not visible to the consumer until commit() is called.
+ * @note    Must only be called by the producer
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+T* SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::reserve()
+{
+    return full() ? nullptr : SlotAddress(producer.tail.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief   Publishes the element written into the reserved slot
+ * @note    The slot is cleaned before the index, so the consumer never observes the index ahead of the data.
+ * @note    Must only be called by the producer, after a successful reserve()
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+void SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::commit()
+{
+    const index_type tailIdx = producer.tail.load(std::memory_order_relaxed);       // Own index
+    const T* const   slot    = SlotAddress(tailIdx);
+
+    SharedMemoryT::Clean(LineStart(slot), LineSpan(slot));
+
+    producer.tail.store(NextIndex(tailIdx), std::memory_order_release);
+    SharedMemoryT::Clean(&producer, sizeof(producer));
+
+    SharedMemoryT::NotifyConsumer();
+}
+
+/**
+ * @brief   Constructs the element in the shared memory and publishes it
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @return  true    If the operation is successful.
+ *          false   If the queue was full
+ * @note    Must only be called by the producer
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+template <class... Args>
+bool SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::emplace(Args&&... args)
+{
+    T* const slot = reserve();
+
+    if(nullptr == slot)
+        return false;
+
+    new(slot) value_type(std::forward<Args>(args)...);
+    commit();
+
+    return true;
+}
+
+/**
+ * @brief   Copies the element into the shared memory and publishes it
+ * @param   value   Constant lValue reference to the object to be pushed
+ * @return  true    If the operation is successful.
+ *          false   If the queue was full
+ * @note    Must only be called by the producer
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+bool SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::push(const value_type& value)
+{
+    return emplace(value);
+}
+
+/**
+ * @brief   Checks whether the producer has any free slot
+ * @return  true if the queue is full
+ * @note    The consumer's line is read only if the last observed consumer index reports a full queue.
+ * @note    Must only be called by the producer
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+bool SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::full()
+{
+    const index_type tailIdx = producer.tail.load(std::memory_order_relaxed);       // Own index
+
+    if(SIZE != Distance(producer.observedHead, tailIdx))
+        return false;
+
+    SharedMemoryT::Invalidate(&consumer, sizeof(consumer));
+    producer.observedHead = consumer.head.load(std::memory_order_acquire);          // Synchronize with the consumer's release
+
+    return (SIZE == Distance(producer.observedHead, tailIdx));
+}
+
+/**
+ * @brief   Returns the front element in place
+ * @return  Pointer to the element in the shared memory, nullptr if the queue is empty
+ * @note    The element stays valid until release() is called.
+ * @note    Must only be called by the consumer
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+const T* SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::peek()
+{
+    if(empty())
+        return nullptr;
+
+    const T* const slot = SlotAddress(consumer.head.load(std::memory_order_relaxed));
+
+    SharedMemoryT::Invalidate(LineStart(slot), LineSpan(slot));
+
+    return slot;
+}
+
+/**
+ * @brief   Hands the front slot back to the producer
+ * @note    Must only be called by the consumer, after a successful peek()
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+void SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::release()
+{
+    const index_type headIdx = consumer.head.load(std::memory_order_relaxed);       // Own index
+
+    consumer.head.store(NextIndex(headIdx), std::memory_order_release);
+    SharedMemoryT::Clean(&consumer, sizeof(consumer));
+
+    SharedMemoryT::NotifyProducer();
+}
+
+/**
+ * @brief   Copies the front element out of the shared memory and releases its slot
+ * @param   destination     Object to be assigned with the front element
+ * @return  true    If the operation is successful.
+ *          false   If the queue was empty
+ * @note    Must only be called by the consumer
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+bool SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::pop(value_type& destination)
+{
+    const T* const element = peek();
+
+    if(nullptr == element)
+        return false;
+
+    destination = *element;
+    release();
+
+    return true;
+}
+
+/**
+ * @brief   Checks whether the consumer has any element to read
+ * @return  true if the queue is empty
+ * @note    The producer's line is read only if the last observed producer index reports an empty queue.
+ * @note    Must only be called by the consumer
+ */
+template<class T, std::size_t SIZE, class SharedMemoryT, std::size_t LINE_SIZE>
+bool SharedQueue<T, SIZE, SharedMemoryT, LINE_SIZE>::empty()
+{
+    const index_type headIdx = consumer.head.load(std::memory_order_relaxed);       // Own index
+
+    if(headIdx != consumer.observedTail)
+        return false;
+
+    SharedMemoryT::Invalidate(&producer, sizeof(producer));
+    consumer.observedTail = producer.tail.load(std::memory_order_acquire);          // Synchronize with the producer's release
+
+    return (headIdx == consumer.observedTail);
+}
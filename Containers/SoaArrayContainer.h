@@ -0,0 +1,149 @@
+/**
+ * @file        SoaArrayContainer.h
+ * @details     A template structure-of-arrays container built on the Array container.
+ *              Each field of the element is stored in its own contiguous Array, so a loop over
+ *              a single field runs at stride 1 without pulling the other fields through the cache.
+ *              Elements are accessed through proxies which are tuples of references to the fields.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> footprint_bytes() added for memory budgets.
+ *
+ * @note        Fields are named by their indices, an unscoped enumeration reads well, e.g.
+ *              enum SampleField { Timestamp, X, Y, Z, Flags };
+ *              SoaArray<1024, uint32_t, int16_t, int16_t, int16_t, uint16_t> samples;
+ *              for(auto& x : samples.field<X>()) { ... }
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <tuple>        // std::tuple, std::get, std::tuple_element_t
+#include <utility>      // std::index_sequence
+#include <cassert>      // assert
+#include "ArrayContainer.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+template<std::size_t SIZE, class... Fields>
+class SoaArray{
+    static_assert(SIZE != 0, "SoaArray size cannot be zero!");
+    static_assert(sizeof...(Fields) != 0, "SoaArray must have at least one field!");
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type        = std::tuple<Fields...>;            // Element as a copy of its fields
+    using reference         = std::tuple<Fields&...>;           // Element proxy, assignable from value_type
+    using const_reference   = std::tuple<const Fields&...>;     // Read-only element proxy
+    using size_type         = std::size_t;
+    using difference_type   = std::ptrdiff_t;
+
+    template<std::size_t I>
+    using field_type        = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    template<std::size_t I>
+    using column_type       = Array<field_type<I>, SIZE>;
+
+    static constexpr std::size_t FIELD_COUNT = sizeof...(Fields);
+
+    /*** Constructors and Destructors ***/
+    SoaArray() = default;
+
+    // Fill constructor, each field is filled with its own value
+    constexpr explicit SoaArray(const Fields&... fillValues) : columns(Array<Fields, SIZE>(fillValues)...) { /* No operation */ }
+
+    /*** Field Access ***/
+    template<std::size_t I>
+    NODISCARD constexpr column_type<I>&         field() noexcept        { return std::get<I>(columns); }    // Contiguous storage of a field
+    template<std::size_t I>
+    NODISCARD constexpr const column_type<I>&   field() const noexcept  { return std::get<I>(columns); }    // Contiguous storage of a field
+
+    /*** Element Access ***/
+    NODISCARD constexpr reference       operator[](const size_type index)           { return Element(index, std::index_sequence_for<Fields...>());      }
+    NODISCARD constexpr const_reference operator[](const size_type index) const     { return Element(index, std::index_sequence_for<Fields...>());      }
+    NODISCARD constexpr reference       at(const size_type position)                { assert(position < SIZE); return (*this)[position];                }
+    NODISCARD constexpr const_reference at(const size_type position) const          { assert(position < SIZE); return (*this)[position];                }
+
+    /*** Operators ***/
+    NODISCARD constexpr bool operator==(const SoaArray& rightArr) const { return (columns == rightArr.columns);   }
+    NODISCARD constexpr bool operator!=(const SoaArray& rightArr) const { return !(*this == rightArr);            }
+
+    /*** Operations ***/
+    constexpr SoaArray& Fill(const Fields&... fillValues)
+    {
+        FillEach(std::index_sequence_for<Fields...>(), fillValues...);
+
+        return *this;
+    }
+
+    template<std::size_t I, class U>
+    constexpr SoaArray& Fill(const U& fillValue)
+    {
+        field<I>().Fill(fillValue);
+
+        return *this;
+    }
+
+    template<std::size_t I, class U>
+    constexpr SoaArray& Fill(const U& fillValue, const size_type startPos, const size_type endPos = SIZE)
+    {
+        field<I>().Fill(fillValue, startPos, endPos);
+
+        return *this;
+    }
+
+    template<std::size_t I, class U>
+    constexpr SoaArray& Fill(const U& fillValue, typename column_type<I>::iterator startPos, typename column_type<I>::iterator endPos)
+    {
+        field<I>().Fill(fillValue, startPos, endPos);
+
+        return *this;
+    }
+
+    template<std::size_t I, class RuleT>
+    constexpr SoaArray& FillWithRule(const RuleT& predicate)
+    {
+        field<I>().FillWithRule(predicate);
+
+        return *this;
+    }
+
+    /*** Status Checkers ***/
+    NODISCARD constexpr size_type max_size() const noexcept   { return SIZE;                            }    // Return the maximum possible size
+    NODISCARD constexpr size_type size() const noexcept       { return SIZE;                            }    // Returns total number of elements
+    NODISCARD constexpr size_type sizeRaw() const noexcept    { return SIZE * (0 + ... + sizeof(Fields)); } // Size of the fields in bytes
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(SoaArray); } // Memory taken by an instance, including bookkeeping and padding
+    NODISCARD constexpr bool empty() const noexcept           { return false;                           }
+
+private:
+    std::tuple<Array<Fields, SIZE>...> columns;   // Storage of each field
+
+    /*** Helper Functions ***/
+    template<std::size_t... I>
+    constexpr reference Element(const size_type index, std::index_sequence<I...>)
+    {
+        return reference(std::get<I>(columns)[index]...);
+    }
+
+    template<std::size_t... I>
+    constexpr const_reference Element(const size_type index, std::index_sequence<I...>) const
+    {
+        return const_reference(std::get<I>(columns)[index]...);
+    }
+
+    template<std::size_t... I>
+    constexpr void FillEach(std::index_sequence<I...>, const Fields&... fillValues)
+    {
+        (std::get<I>(columns).Fill(fillValues), ...);
+    }
+};
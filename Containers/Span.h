@@ -0,0 +1,74 @@
+/**
+ * @file        Span.h
+ * @details     A non-owning view over a contiguous sequence of elements.
+ *              Containers use it to expose their storage without copying.
+ *              Ring containers expose their content as a pair of views, split at the wraparound point.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> SpanPair added for wrapped storage.
+ *
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>  // std::size_t
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** View Class ***/
+template<class T>
+class Span{
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using element_type      = T;
+    using reference         = T&;
+    using pointer           = T*;
+    using iterator          = T*;
+    using difference_type   = std::ptrdiff_t;
+    using size_type         = std::size_t;
+
+    /*** Constructors ***/
+    constexpr Span() noexcept = default;
+    constexpr Span(pointer first, const size_type count) noexcept : ptr(first), sz(count) { /* No operation */ }
+
+    /*** Element Access ***/
+    NODISCARD constexpr iterator  begin()   const noexcept  { return ptr;       }
+    NODISCARD constexpr iterator  end()     const noexcept  { return ptr + sz;  }
+    NODISCARD constexpr pointer   data()    const noexcept  { return ptr;       }
+
+    NODISCARD constexpr reference operator[](const size_type index) const  { return ptr[index]; }
+
+    /*** Status Checkers ***/
+    NODISCARD constexpr size_type size()        const noexcept  { return sz;                }   // Number of elements
+    NODISCARD constexpr size_type size_bytes()  const noexcept  { return sz * sizeof(T);    }   // Size in bytes
+    NODISCARD constexpr bool      empty()       const noexcept  { return (0 == sz);         }   // true if there is no element
+
+private:
+    pointer   ptr{nullptr};     // First element
+    size_type sz{0};            // Number of elements
+};
+
+/*** Segmented View ***/
+/**
+ * @brief   Two views which form a single logical sequence, e.g. the content of a wrapped ring buffer
+ * @note    The second view is empty if the sequence is contiguous.
+ */
+template<class T>
+struct SpanPair{
+    Span<T> first;      // Leading part of the sequence
+    Span<T> second;     // Trailing part of the sequence
+
+    NODISCARD constexpr std::size_t size()          const noexcept  { return first.size() + second.size();              }   // Number of elements
+    NODISCARD constexpr std::size_t size_bytes()    const noexcept  { return first.size_bytes() + second.size_bytes();  }   // Size in bytes
+    NODISCARD constexpr bool        empty()         const noexcept  { return first.empty() && second.empty();           }   // true if there is no element
+};
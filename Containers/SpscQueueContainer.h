@@ -0,0 +1,318 @@
+/**
+ * @file        SpscQueueContainer.h
+ * @details     A template single-producer/single-consumer queue container for embedded systems.
+ *              The container is implemented without any dynamic allocation feature.
+ *              Producer and consumer own separate atomic indices, hence a producer (e.g. an ISR)
+ *              and a consumer (e.g. the main loop) can access the queue concurrently without
+ *              any critical section. The interface mirrors the Queue container.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Layout policy added to avoid false sharing of the indices.
+ *                               -> footprint_bytes() added for memory budgets.
+ *
+ * @note        Only one context may call the producer side methods (emplace, push, back) and
+ *              only one context may call the consumer side methods (front, pop) at a time.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>      // std::size_t
+#include <utility>      // std::move, std::forward
+#include <type_traits>  // std::aligned_storage
+#include <new>          // operator new
+#include <atomic>       // std::atomic
+#include "ConcurrentLayout.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+template<class T, std::size_t SIZE, class LayoutT = DefaultConcurrentLayout>
+class SpscQueue{
+    static_assert(SIZE != 0, "Queue capacity cannot be zero!");
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type        = T;
+    using reference         = T&;
+    using const_reference   = const T&;
+    using difference_type   = std::ptrdiff_t;
+    using size_type         = std::size_t;
+    using aligned_data      = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    /*** Constructors and Destructor ***/
+    // Default constructor
+    SpscQueue() = default;
+
+    // Concurrent containers are not copyable
+    SpscQueue(const SpscQueue&)             = delete;
+    SpscQueue& operator=(const SpscQueue&)  = delete;
+
+    // Destructor
+    ~SpscQueue();
+
+    /*** Element Access ***/
+    NODISCARD const_reference front() const;    // Consumer side
+    NODISCARD reference       front();          // Consumer side
+    NODISCARD const_reference back() const;     // Producer side
+    NODISCARD reference       back();           // Producer side
+
+    /*** Modifiers ***/
+    template <class... Args>
+    bool emplace(Args&&... args);               // Producer side
+    bool push(const value_type& value);         // Producer side
+    bool push(value_type&& value);              // Producer side
+
+    void pop();                                 // Consumer side
+
+    /*** Status Checkers ***/
+    NODISCARD bool      empty()     const { return (0     == size()); } // true if the Queue is empty
+    NODISCARD bool      full()      const { return (SIZE  == size()); } // true if the Queue is full
+    NODISCARD size_type size()      const;                              // Current size of the Queue
+    NODISCARD size_type capacity()  const { return SIZE;              } // Maximum capacity of the Queue
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(SpscQueue); } // Memory taken by an instance, including bookkeeping and padding
+    NODISCARD size_type available() const { return (SIZE - size());   } // Available slots in Queue
+
+private:
+    /*** Members ***/
+    /* Indices run over [0, 2*SIZE) so that a full queue can be distinguished
+     * from an empty one without a shared size counter or a sacrificed slot.
+     * With a caching layout, each side also keeps the last observed index of the other side. */
+    ContainerDetail::OwnedIndex<size_type, LayoutT> head;   // Index of the front element, written by the consumer only
+    ContainerDetail::OwnedIndex<size_type, LayoutT> tail;   // Index after the back element, written by the producer only
+    aligned_data                                    data[SIZE]; // Stored data
+
+    /*** Helper functions ***/
+    static size_type NextIndex(const size_type index) // Increments any index by not violating the range
+    {
+        return (2*SIZE-1 == index) ? 0 : index+1;
+    }
+
+    static size_type Slot(const size_type index) // Converts an index to the storage slot
+    {
+        return (index < SIZE) ? index : index-SIZE;
+    }
+
+    static size_type Distance(const size_type head, const size_type tail) // Number of elements in between
+    {
+        return (tail >= head) ? (tail - head) : (tail + 2*SIZE - head);
+    }
+
+    NODISCARD size_type ObservedHead(const size_type tailIdx); // Producer's view of the consumer index
+    NODISCARD size_type ObservedTail(const size_type headIdx); // Consumer's view of the producer index
+
+    NODISCARD const_reference at(const size_type index) const
+    {
+        return reinterpret_cast<const_reference>(data[Slot(index)]);
+    }
+
+    NODISCARD reference at(const size_type index)
+    {
+        return reinterpret_cast<reference>(data[Slot(index)]);
+    }
+};
+
+/**
+ * @brief   Destructor
+ * @note    Calls the destructor of each element explicitly
+ * @note    The queue must not be accessed concurrently during destruction
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+SpscQueue<T, SIZE, LayoutT>::~SpscQueue()
+{
+    while(!empty())
+        pop();
+}
+
+/**
+ * @brief   Returns a constant lValue reference to the front element of Queue
+ * @return  Constant lValue reference to the front element
+ * @note    Must only be called by the consumer
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+const T& SpscQueue<T, SIZE, LayoutT>::front() const
+{
+    return at(head.value.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief   Returns an lValue reference to the front element of Queue
+ * @return  lValue reference to the front element
+ * @note    Must only be called by the consumer
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+T& SpscQueue<T, SIZE, LayoutT>::front()
+{
+    return at(head.value.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief   Returns a constant lValue reference to the back element of Queue
+ * @return  Constant lValue reference to the back element
+ * @note    Must only be called by the producer
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+const T& SpscQueue<T, SIZE, LayoutT>::back() const
+{
+    const size_type tailIdx = tail.value.load(std::memory_order_relaxed);
+
+    return at((0 == tailIdx) ? 2*SIZE-1 : tailIdx-1);
+}
+
+/**
+ * @brief   Returns an lValue reference to the back element of Queue
+ * @return  lValue reference to the back element
+ * @note    Must only be called by the producer
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+T& SpscQueue<T, SIZE, LayoutT>::back()
+{
+    const size_type tailIdx = tail.value.load(std::memory_order_relaxed);
+
+    return at((0 == tailIdx) ? 2*SIZE-1 : tailIdx-1);
+}
+
+/**
+ * @brief   Pushes the element by constructing it in-place with the given arguments
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @return  true    If the operation is successful.
+ *          false   If the queue was full
+ * @note    Must only be called by the producer
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+template <class... Args>
+bool SpscQueue<T, SIZE, LayoutT>::emplace(Args&&... args)
+{
+    const size_type tailIdx = tail.value.load(std::memory_order_relaxed);          // Own index
+
+    if(SIZE == Distance(ObservedHead(tailIdx), tailIdx))
+        return false;
+
+    // In-place construct element with the arguments at the back
+    new(data + Slot(tailIdx)) value_type(std::forward<Args>(args)...);
+
+    // Publish the element to the consumer
+    tail.value.store(NextIndex(tailIdx), std::memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief   Pushes the element to the Queue
+ * @param   value   Constant lValue reference to the object to be pushed
+ * @return  true    If the operation is successful.
+ *          false   If the queue was full
+ * @note    Must only be called by the producer
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+bool SpscQueue<T, SIZE, LayoutT>::push(const value_type& value)
+{
+    return emplace(value);
+}
+
+/**
+ * @brief   Pushes the element to the Queue
+ * @param   value   rValue reference to the object to be pushed
+ * @return  true    If the operation is successful.
+ *          false   If the queue was full
+ * @note    Must only be called by the producer
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+bool SpscQueue<T, SIZE, LayoutT>::push(value_type&& value)
+{
+    return emplace(std::move(value));
+}
+
+/**
+ * @brief   Pops the front element of the Queue
+ * @note    Explicitly calls the destructor of the popped element
+ * @note    Must only be called by the consumer
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+void SpscQueue<T, SIZE, LayoutT>::pop()
+{
+    const size_type headIdx = head.value.load(std::memory_order_relaxed);          // Own index
+
+    if(headIdx == ObservedTail(headIdx))
+        return;
+
+    // Explicitly call the destructor as we used the placement new
+    at(headIdx).~value_type();
+
+    // Hand the slot back to the producer
+    head.value.store(NextIndex(headIdx), std::memory_order_release);
+}
+
+/**
+ * @brief   Returns the current number of elements
+ * @return  Number of elements in the Queue
+ * @note    The result is a snapshot when called concurrently from the other side.
+ *          It is exact for the caller's own operations.
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+std::size_t SpscQueue<T, SIZE, LayoutT>::size() const
+{
+    const size_type headIdx = head.value.load(std::memory_order_acquire);
+    const size_type tailIdx = tail.value.load(std::memory_order_acquire);
+
+    return Distance(headIdx, tailIdx);
+}
+
+/**
+ * @brief   Returns the consumer index as seen by the producer
+ * @param   tailIdx     Current producer index
+ * @return  Consumer index which is either the cached one or a fresh one
+ * @note    A stale consumer index is safe as it can only underestimate the free slots.
+ *          The consumer's cache line is read only if the cached index reports a full queue.
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+std::size_t SpscQueue<T, SIZE, LayoutT>::ObservedHead(const size_type tailIdx)
+{
+    if constexpr(LayoutT::cacheIndices)
+    {
+        if(SIZE == Distance(tail.cached, tailIdx))
+            tail.cached = head.value.load(std::memory_order_acquire);           // Synchronize with the consumer's release
+
+        return tail.cached;
+    }
+    else
+    {
+        (void)tailIdx;
+
+        return head.value.load(std::memory_order_acquire);                      // Synchronize with the consumer's release
+    }
+}
+
+/**
+ * @brief   Returns the producer index as seen by the consumer
+ * @param   headIdx     Current consumer index
+ * @return  Producer index which is either the cached one or a fresh one
+ * @note    A stale producer index is safe as it can only underestimate the stored elements.
+ *          The producer's cache line is read only if the cached index reports an empty queue.
+ */
+template<class T, std::size_t SIZE, class LayoutT>
+std::size_t SpscQueue<T, SIZE, LayoutT>::ObservedTail(const size_type headIdx)
+{
+    if constexpr(LayoutT::cacheIndices)
+    {
+        if(headIdx == head.cached)
+            head.cached = tail.value.load(std::memory_order_acquire);           // Synchronize with the producer's release
+
+        return head.cached;
+    }
+    else
+    {
+        (void)headIdx;
+
+        return tail.value.load(std::memory_order_acquire);                      // Synchronize with the producer's release
+    }
+}
@@ -13,6 +13,15 @@
  *                            -> lvalue ref-qualifier added to assignment operator.
  *                            -> Helper function at(..) added to avoid repetition of casting.
  *              July 17, 2021 -> Swap issue fixed with manual swapping of the storage.
+ *              October 14, 2026 -> Bulk copy, swap and destruction for trivial types.
+ *                               -> Self assignment issue fixed.
+ *                               -> Move constructor and move assignment operator added.
+ *                               -> Swap moves the elements without any swappable match.
+ *                               -> Top index narrowed to the smallest type holding the capacity.
+ *                               -> Optional usage statistics policy added.
+ *                               -> Bulk push_n(..), pop_n(..), peek(..) and unchecked methods added.
+ *                               -> Marker based rewind and RAII scope guard added.
+ *                               -> footprint_bytes() added for memory budgets.
  *
  * @note        Feel free to contact for questions, bugs or any other thing.
  * @copyright   No copyright.
@@ -22,8 +31,14 @@
 #pragma once
 
 /*** Libraries ***/
-#include <cstddef>  // std::size_t
-#include <utility>  // std::move, std::swap
+#include <cstddef>      // std::size_t
+#include <utility>      // std::move, std::swap
+#include <type_traits>  // std::aligned_storage
+#include <new>          // operator new
+#include <algorithm>    // std::min, std::max, std::swap_ranges
+#include <iterator>     // std::iterator_traits, std::distance
+#include "ContainerHelpers.h"
+#include "ContainerStats.h"
 
 /*** Special definitions ***/
 // If the C++ version is greater or equal to 2017xx
@@ -34,8 +49,8 @@
 #endif
 
 /*** Container Class ***/
-template<class T, std::size_t SIZE>
-class Stack{
+template<class T, std::size_t SIZE, class StatsT = NoStats>
+class Stack : private StatsT::template Tracker<SIZE>{
     static_assert(SIZE != 0, "Stack capacity cannot be zero!");
 
 public:
@@ -46,6 +61,24 @@ public:
     using difference_type   = std::ptrdiff_t;
     using size_type         = std::size_t;
     using aligned_data      = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+    using stats_type        = typename StatsT::template Tracker<SIZE>;
+    using marker_type       = std::size_t;
+
+    /*** RAII Scope Guard ***/
+    // Rewinds the Stack to its size at the construction of the guard, unless it is dismissed
+    class Scope{
+    public:
+        explicit Scope(Stack& stack) noexcept : owner(&stack), marker(stack.mark()) { /* No operation */ }
+        Scope(const Scope&)             = delete;
+        Scope& operator=(const Scope&)  = delete;
+        ~Scope()                                    { if(nullptr != owner) owner->rewind(marker); }
+
+        void dismiss() noexcept                     { owner = nullptr; }    // Keeps the elements pushed within the scope
+
+    private:
+        Stack*      owner;      // Stack to be rewound
+        marker_type marker;     // Size of the Stack at the beginning of the scope
+    };
 
     /*** Constructors and Destructor ***/
     // Default constructor
@@ -54,6 +87,9 @@ public:
     // Copy constructor
     Stack(const Stack& copyStack);
 
+    // Move constructor
+    Stack(Stack&& moveStack) noexcept(std::is_nothrow_move_constructible_v<T>);
+
     // Destructor
     ~Stack();
 
@@ -61,30 +97,59 @@ public:
     NODISCARD const_reference top() const;
     NODISCARD reference       top();
 
+    NODISCARD const_reference peek(const size_type depth) const   { return at(idxTop-1-depth); } // Element at the depth from the top, unchecked
+    NODISCARD reference       peek(const size_type depth)         { return at(idxTop-1-depth); } // Element at the depth from the top, unchecked
+
     /*** Modifiers ***/
     template <class... Args>
     bool emplace(Args&&... args);
     bool push(const value_type& value);
     bool push(value_type&& value);
     void pop();
-    void swap(Stack& swapStack);
+
+    template<class InputIt>
+    size_type push_n(InputIt source, size_type count);
+    template<class InputIt>
+    size_type push_n(InputIt first, InputIt last);
+    template<class OutputIt>
+    size_type pop_n(OutputIt destination, size_type count);
+
+    /*** Unchecked Modifiers ***/
+    // The caller guarantees that the Stack is not full (push) or not empty (pop)
+    template <class... Args>
+    void emplace_unchecked(Args&&... args);
+    void push_unchecked(const value_type& value);
+    void push_unchecked(value_type&& value);
+    void pop_unchecked();
+
+    /*** Markers ***/
+    NODISCARD marker_type   mark() const        { return idxTop;        } // Current position of the top
+    NODISCARD Scope         scope()             { return Scope(*this);  } // Guard which rewinds to the current position
+    void rewind(marker_type marker);
+
+    void swap(Stack& swapStack) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>);
 
     /*** Operators ***/
     bool operator==(const Stack& compStack) const;
     bool operator!=(const Stack& compStack) const;
     Stack& operator=(const Stack& sourceStack) &;
+    Stack& operator=(Stack&& sourceStack) & noexcept(std::is_nothrow_move_constructible_v<T>);
 
     /*** Status Checkers ***/
     NODISCARD bool      empty()     const { return (0     == idxTop); } // true if the Stack is empty
     NODISCARD bool      full()      const { return (SIZE  == idxTop); } // true if the Stack is full
     NODISCARD size_type size()      const { return idxTop;            } // Current size of the Stack
     NODISCARD size_type capacity()  const { return SIZE;              } // Maximum capacity of the Stack
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(Stack); } // Memory taken by an instance, including bookkeeping and padding
     NODISCARD size_type available() const { return (SIZE - size());   } // Available slots in Stack
 
+    /*** Statistics ***/
+    NODISCARD const stats_type& stats() const { return *this; }        // Usage statistics, empty for NoStats
+
 private:
     /*** Members ***/
-    size_type    idxTop{0};     // Index after the top element
-    aligned_data data[SIZE];    // Contained data
+    ContainerDetail::SmallestIndex<SIZE> idxTop{0};     // Index after the top element
+    aligned_data data[SIZE];                            // Contained data
 
     /*** Helper Functions ***/
     NODISCARD const_reference at(const size_type elemIdx) const
@@ -96,26 +161,48 @@ private:
     {
         return reinterpret_cast<reference>(data[elemIdx]);
     }
+
+    NODISCARD const T* slot(const size_type slotIdx) const
+    {
+        return reinterpret_cast<const T*>(data + slotIdx);
+    }
+
+    NODISCARD T* slot(const size_type slotIdx)
+    {
+        return reinterpret_cast<T*>(data + slotIdx);
+    }
+
+    NODISCARD stats_type& Tracker() { return *this; }
 };
 
 /**
  * @brief Copy constructor
  * @param copyStack     Source stack for copying
  */
-template<class T, std::size_t SIZE>
-Stack<T, SIZE>::Stack(const Stack& copyStack)
+template<class T, std::size_t SIZE, class StatsT>
+Stack<T, SIZE, StatsT>::Stack(const Stack& copyStack)
 {
     *this = copyStack;
 }
 
+/**
+ * @brief Move constructor
+ * @param moveStack     Source stack for moving, it is left empty
+ */
+template<class T, std::size_t SIZE, class StatsT>
+Stack<T, SIZE, StatsT>::Stack(Stack&& moveStack) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    *this = std::move(moveStack);
+}
+
 /**
  * @brief Destructor
  */
-template<class T, std::size_t SIZE>
-Stack<T, SIZE>::~Stack()
+template<class T, std::size_t SIZE, class StatsT>
+Stack<T, SIZE, StatsT>::~Stack()
 {
-    while(!empty())
-        pop();
+    // Compiles to nothing for trivially destructible types
+    ContainerDetail::DestroyRange(slot(0), idxTop);
 }
 
 /**
@@ -123,8 +210,8 @@ Stack<T, SIZE>::~Stack()
  * @return  Constant lValue reference to the front element
  * @note    The referenced data is not valid if the Stack is empty
  */
-template<class T, std::size_t SIZE>
-const T& Stack<T, SIZE>::top() const
+template<class T, std::size_t SIZE, class StatsT>
+const T& Stack<T, SIZE, StatsT>::top() const
 {
     if(empty())
         return at(0);
@@ -137,8 +224,8 @@ const T& Stack<T, SIZE>::top() const
  * @return  lValue reference to the front element
  * @note    The referenced data is not valid if the Stack is empty
  */
-template<class T, std::size_t SIZE>
-T& Stack<T, SIZE>::top()
+template<class T, std::size_t SIZE, class StatsT>
+T& Stack<T, SIZE, StatsT>::top()
 {
     if(empty())
         return at(0);
@@ -151,16 +238,21 @@ T& Stack<T, SIZE>::top()
  * @param   value   Reference to the value to be copied
  * @return  true    If the element is pushed successfully
  */
-template<class T, std::size_t SIZE>
-bool Stack<T, SIZE>::push(const value_type& value)
+template<class T, std::size_t SIZE, class StatsT>
+bool Stack<T, SIZE, StatsT>::push(const value_type& value)
 {
     if(full())
+    {
+        Tracker().OnPushFailed();
+
         return false;
+    }
 
     // Copy construct element at the top
     new(data + idxTop) value_type(value);
 
     ++idxTop;
+    Tracker().OnPush(idxTop-1, 1, idxTop);
 
     return true;
 }
@@ -170,8 +262,8 @@ bool Stack<T, SIZE>::push(const value_type& value)
  * @param   value   rValue Reference to the value to be moved
  * @return  true    If the element is pushed successfully
  */
-template<class T, std::size_t SIZE>
-bool Stack<T, SIZE>::push(value_type&& value)
+template<class T, std::size_t SIZE, class StatsT>
+bool Stack<T, SIZE, StatsT>::push(value_type&& value)
 {
     return emplace(std::move(value));
 }
@@ -181,16 +273,21 @@ bool Stack<T, SIZE>::push(value_type&& value)
  * @param   args    Arguments for constructing the new element
  * @return  true    If the element is pushed successfully
  */
-template<class T, std::size_t SIZE>
+template<class T, std::size_t SIZE, class StatsT>
 template <class... Args>
-bool Stack<T, SIZE>::emplace(Args&&... args)
+bool Stack<T, SIZE, StatsT>::emplace(Args&&... args)
 {
     if(full())
+    {
+        Tracker().OnPushFailed();
+
         return false;
+    }
 
     new(data + idxTop) value_type(std::forward<Args>(args)...);
 
     ++idxTop;
+    Tracker().OnPush(idxTop-1, 1, idxTop);
 
     return true;
 }
@@ -198,11 +295,17 @@ bool Stack<T, SIZE>::emplace(Args&&... args)
 /**
  * @brief Pops the top element of the stack
  */
-template<class T, std::size_t SIZE>
-void Stack<T, SIZE>::pop()
+template<class T, std::size_t SIZE, class StatsT>
+void Stack<T, SIZE, StatsT>::pop()
 {
     if(empty())
+    {
+        Tracker().OnPopEmpty();
+
         return;
+    }
+
+    Tracker().OnPop(idxTop-1, 1);
 
     // Explicitly call the destructor as we used the placement new
     at(idxTop-1).~value_type();
@@ -210,13 +313,176 @@ void Stack<T, SIZE>::pop()
     --idxTop;
 }
 
+/**
+ * @brief   Pushes multiple elements to the top of the Stack
+ * @param   source  Iterator to the first element to be copied
+ * @param   count   Number of elements to be pushed
+ * @return  Number of elements pushed, which is limited by the available slots
+ * @note    The last pushed element becomes the top one.
+ *          A single memcpy is used if the elements are trivially copyable.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+template<class InputIt>
+std::size_t Stack<T, SIZE, StatsT>::push_n(InputIt source, size_type count)
+{
+    if(count > available())
+    {
+        Tracker().OnPushFailed();
+        count = available();
+    }
+
+    ContainerDetail::ConstructRange(slot(idxTop), source, count);
+
+    const size_type firstSlot = idxTop;
+
+    idxTop = static_cast<ContainerDetail::SmallestIndex<SIZE>>(idxTop + count);
+    Tracker().OnPush(firstSlot, count, idxTop);
+
+    return count;
+}
+
+/**
+ * @brief   Pushes the elements in the given range to the top of the Stack
+ * @param   first   Iterator to the first element to be copied
+ * @param   last    Iterator after the last element to be copied
+ * @return  Number of elements pushed, which is limited by the available slots
+ */
+template<class T, std::size_t SIZE, class StatsT>
+template<class InputIt>
+std::size_t Stack<T, SIZE, StatsT>::push_n(InputIt first, InputIt last)
+{
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+
+    // Multi-pass ranges can be measured beforehand
+    if constexpr(std::is_base_of_v<std::forward_iterator_tag, category>)
+    {
+        return push_n(first, static_cast<size_type>(std::distance(first, last)));
+    }
+    else
+    {
+        size_type count = 0;
+
+        for( ; (first != last) && emplace(*first); ++first)
+            ++count;
+
+        return count;
+    }
+}
+
+/**
+ * @brief   Pops multiple elements from the top of the Stack
+ * @param   destination     Iterator to the first element to be assigned
+ * @param   count           Number of elements to be popped
+ * @return  Number of elements popped, which is limited by the size of the Stack
+ * @note    Elements are moved out in their push order, the old top element is the last one.
+ *          Hence, pop_n(..) restores the sequence given to push_n(..).
+ *          A single memcpy is used if the elements are trivially copyable.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+template<class OutputIt>
+std::size_t Stack<T, SIZE, StatsT>::pop_n(OutputIt destination, size_type count)
+{
+    if((0 != count) && empty())
+        Tracker().OnPopEmpty();
+
+    count = std::min(count, size());
+    idxTop = static_cast<ContainerDetail::SmallestIndex<SIZE>>(idxTop - count);
+
+    Tracker().OnPop(idxTop, count);
+    ContainerDetail::MoveOutRange(slot(idxTop), count, destination);
+
+    return count;
+}
+
+/**
+ * @brief   Pushes the element constructed with the given arguments without checking the capacity
+ * @param   args    Arguments for constructing the new element
+ * @note    The Stack must not be full.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+template <class... Args>
+void Stack<T, SIZE, StatsT>::emplace_unchecked(Args&&... args)
+{
+    new(data + idxTop) value_type(std::forward<Args>(args)...);
+
+    ++idxTop;
+    Tracker().OnPush(idxTop-1, 1, idxTop);
+}
+
+/**
+ * @brief   Pushes the given element without checking the capacity
+ * @param   value   Reference to the value to be copied
+ * @note    The Stack must not be full.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+void Stack<T, SIZE, StatsT>::push_unchecked(const value_type& value)
+{
+    emplace_unchecked(value);
+}
+
+/**
+ * @brief   Pushes the given element without checking the capacity
+ * @param   value   rValue Reference to the value to be moved
+ * @note    The Stack must not be full.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+void Stack<T, SIZE, StatsT>::push_unchecked(value_type&& value)
+{
+    emplace_unchecked(std::move(value));
+}
+
+/**
+ * @brief   Pops the top element without checking the size
+ * @note    The Stack must not be empty.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+void Stack<T, SIZE, StatsT>::pop_unchecked()
+{
+    Tracker().OnPop(idxTop-1, 1);
+
+    // Explicitly call the destructor as we used the placement new
+    at(idxTop-1).~value_type();
+
+    --idxTop;
+}
+
+/**
+ * @brief   Pops every element pushed after the given marker
+ * @param   marker  Value returned by mark()
+ * @note    The elements are destroyed in a single pass, which compiles to an index reset
+ *          for trivially destructible types. Markers above the current top are ignored.
+ */
+template<class T, std::size_t SIZE, class StatsT>
+void Stack<T, SIZE, StatsT>::rewind(const marker_type marker)
+{
+    if(marker >= idxTop)
+        return;
+
+    Tracker().OnPop(marker, idxTop - marker);
+    ContainerDetail::DestroyRange(slot(marker), idxTop - marker);
+
+    idxTop = static_cast<ContainerDetail::SmallestIndex<SIZE>>(marker);
+}
+
 /**
  * @brief Swaps the content of two Stacks
  * @param swapStack     Stack to be swapped with
  */
-template<class T, std::size_t SIZE>
-void Stack<T, SIZE>::swap(Stack& swapStack)
+template<class T, std::size_t SIZE, class StatsT>
+void Stack<T, SIZE, StatsT>::swap(Stack& swapStack) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>)
 {
+    // Trivially copyable elements are exchanged along with the raw storage
+    if constexpr(std::is_trivially_copyable_v<T>)
+    {
+        std::swap_ranges(data, data + std::max(idxTop, swapStack.idxTop), swapStack.data);
+        std::swap(idxTop, swapStack.idxTop);
+
+        Tracker().OnPush(0, idxTop, idxTop);
+        swapStack.Tracker().OnPush(0, swapStack.idxTop, swapStack.idxTop);
+
+        return;
+    }
+
     size_type swapIdx = 0;  // Number of swapped elements
 
     // Swap elements unless exceeding any of the top indexes
@@ -235,7 +501,7 @@ void Stack<T, SIZE>::swap(Stack& swapStack)
         for( ; swapIdx < idxTop; ++swapIdx)
         {
             // Construct element at new Stack
-            new(swapStack.data + swapIdx) value_type(at(swapIdx));
+            new(swapStack.data + swapIdx) value_type(std::move(at(swapIdx)));
 
             // Remove element from previous Stack
             at(swapIdx).~value_type();
@@ -246,7 +512,7 @@ void Stack<T, SIZE>::swap(Stack& swapStack)
         for( ; swapIdx < swapStack.idxTop; ++swapIdx)
         {
             // Construct element at new Stack
-            new(data + swapIdx) value_type(swapStack.at(swapIdx));
+            new(data + swapIdx) value_type(std::move(swapStack.at(swapIdx)));
 
             // Remove element from previous Stack
             swapStack.at(swapIdx).~value_type();
@@ -259,6 +525,10 @@ void Stack<T, SIZE>::swap(Stack& swapStack)
 
     // Swap indexes
     std::swap(idxTop, swapStack.idxTop);
+
+    // Taken over elements are treated as pushed by now
+    Tracker().OnPush(0, idxTop, idxTop);
+    swapStack.Tracker().OnPush(0, swapStack.idxTop, swapStack.idxTop);
 }
 
 /**
@@ -266,8 +536,8 @@ void Stack<T, SIZE>::swap(Stack& swapStack)
  * @param   compStack   Stack to be compared with.
  * @return  true        If both Stacks are equal.
  */
-template<class T, std::size_t SIZE>
-bool Stack<T, SIZE>::operator==(const Stack& compStack) const
+template<class T, std::size_t SIZE, class StatsT>
+bool Stack<T, SIZE, StatsT>::operator==(const Stack& compStack) const
 {
     if(compStack.size() != size())
         return false;
@@ -284,8 +554,8 @@ bool Stack<T, SIZE>::operator==(const Stack& compStack) const
  * @param   compStack   Stack to be compared with.
  * @return  true        If Stacks are not equal.
  */
-template<class T, std::size_t SIZE>
-bool Stack<T, SIZE>::operator!=(const Stack& compStack) const
+template<class T, std::size_t SIZE, class StatsT>
+bool Stack<T, SIZE, StatsT>::operator!=(const Stack& compStack) const
 {
     return !(*this == compStack);
 }
@@ -295,19 +565,43 @@ bool Stack<T, SIZE>::operator!=(const Stack& compStack) const
  * @param   sourceStack     Stack to be copied from
  * @return  lValue reference to the left Stack to support cascaded operations
  */
-template<class T, std::size_t SIZE>
-Stack<T, SIZE>& Stack<T, SIZE>::operator=(const Stack& sourceStack) &
+template<class T, std::size_t SIZE, class StatsT>
+Stack<T, SIZE, StatsT>& Stack<T, SIZE, StatsT>::operator=(const Stack& sourceStack) &
 {
-    while(!empty())
-        pop();
+    if(this == &sourceStack)    // Check self copy
+        return *this;
 
-    if(!sourceStack.empty())
-    {
-        for(size_type elemIdx = 0; elemIdx < sourceStack.idxTop; ++elemIdx)
-            new(data + elemIdx) value_type(sourceStack.at(elemIdx));
+    ContainerDetail::DestroyRange(slot(0), idxTop);
 
-        idxTop  = sourceStack.idxTop;
-    }
+    // Single memcpy for trivially copyable types
+    ContainerDetail::ConstructRange(slot(0), sourceStack.slot(0), sourceStack.idxTop);
+
+    idxTop = sourceStack.idxTop;
+    Tracker().OnPush(0, idxTop, idxTop);
+
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator
+ * @param   sourceStack     Stack to be moved from, it is left empty
+ * @return  lValue reference to the left Stack to support cascaded operations
+ */
+template<class T, std::size_t SIZE, class StatsT>
+Stack<T, SIZE, StatsT>& Stack<T, SIZE, StatsT>::operator=(Stack&& sourceStack) & noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if(this == &sourceStack)    // Check self move
+        return *this;
+
+    ContainerDetail::DestroyRange(slot(0), idxTop);
+
+    // Single memcpy for trivially copyable types
+    ContainerDetail::RelocateRange(slot(0), sourceStack.slot(0), sourceStack.idxTop);
+
+    idxTop              = sourceStack.idxTop;
+    sourceStack.idxTop  = 0;
+
+    Tracker().OnPush(0, idxTop, idxTop);
 
     return *this;
 }
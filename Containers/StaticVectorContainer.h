@@ -0,0 +1,539 @@
+/**
+ * @file        StaticVectorContainer.h
+ * @details     A template fixed-capacity vector container for embedded systems.
+ *              The container is implemented without any dynamic allocation feature.
+ *              Unlike Array, only the live elements are constructed and destroyed, the rest of
+ *              the storage stays uninitialized. The interface follows the Array container
+ *              (Fill, FillWithRule, comparison) and adds the usual vector modifiers.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ * @note        Failures (e.g. a push to a full vector) are reported with the return values, no exception is thrown.
+ * @note        Feel free to contact for questions, bugs or any other thing.
+ * @copyright   No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>          // std::size_t
+#include <utility>          // std::move, std::forward, std::swap
+#include <type_traits>      // std::aligned_storage
+#include <initializer_list> // std::initializer_list
+#include <iterator>         // std::iterator_traits
+#include <algorithm>        // std::move
+#include <cassert>          // assert
+#include <new>              // operator new
+#include "ArrayContainer.h"
+#include "ContainerHelpers.h"
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+template<class T, std::size_t SIZE>
+class StaticVector{
+    static_assert(SIZE != 0, "StaticVector capacity cannot be zero!");
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type        = T;
+    using size_type         = std::size_t;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = T&;
+    using const_reference   = const T&;
+    using iterator          = T*;
+    using const_iterator    = const T*;
+    using pointer           = T*;
+    using const_pointer     = const T*;
+    using aligned_data      = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    /*** Constructors and Destructor ***/
+    // Default constructor, no element is constructed
+    StaticVector() = default;
+
+    // Fill constructor, count is limited to the capacity
+    StaticVector(const size_type count, const value_type& fillValue);
+
+    // Initializer_list constructor, the elements exceeding the capacity are ignored
+    StaticVector(std::initializer_list<T> initializerList) : StaticVector(initializerList.begin(), initializerList.end()) { /* No operation */ }
+
+    // Iterator range constructor, e.g. from an Array, the elements exceeding the capacity are ignored
+    template<class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    StaticVector(InputIt first, InputIt last);
+
+    // Copy constructor
+    StaticVector(const StaticVector& copyVector);
+
+    // Move constructor
+    StaticVector(StaticVector&& moveVector) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    // Destructor
+    ~StaticVector() { clear(); }
+
+    /*** Element Access ***/
+    NODISCARD iterator          begin() noexcept        { return slot(0);   }
+    NODISCARD const_iterator    begin() const noexcept  { return slot(0);   }
+    NODISCARD iterator          end() noexcept          { return slot(sz);  }
+    NODISCARD const_iterator    end() const noexcept    { return slot(sz);  }
+    NODISCARD const_iterator    cbegin() const noexcept { return slot(0);   }
+    NODISCARD const_iterator    cend() const noexcept   { return slot(sz);  }
+
+    NODISCARD pointer           data() noexcept         { return slot(0);   }
+    NODISCARD const_pointer     data() const noexcept   { return slot(0);   }
+
+    NODISCARD reference         at(const size_type position)        { assert(position < sz); return *slot(position);    }
+    NODISCARD const_reference   at(const size_type position) const  { assert(position < sz); return *slot(position);    }
+    NODISCARD reference         front()                             { return at(0);                                     }   // Not valid if the StaticVector is empty
+    NODISCARD const_reference   front() const                       { return at(0);                                     }   // Not valid if the StaticVector is empty
+    NODISCARD reference         back()                              { return at(sz - 1);                                }   // Not valid if the StaticVector is empty
+    NODISCARD const_reference   back() const                        { return at(sz - 1);                                }   // Not valid if the StaticVector is empty
+
+    /*** Modifiers ***/
+    template<class... Args>
+    bool emplace_back(Args&&... args);
+    bool push_back(const value_type& value)     { return emplace_back(value);               }
+    bool push_back(value_type&& value)          { return emplace_back(std::move(value));    }
+    void pop_back();
+
+    template<class... Args>
+    bool emplace(const size_type position, Args&&... args);
+    bool insert(const size_type position, const value_type& value)  { return emplace(position, value);              }
+    bool insert(const size_type position, value_type&& value)       { return emplace(position, std::move(value));   }
+
+    void erase(const size_type position);
+    void erase(const size_type startPos, const size_type endPos);
+    void swap_remove(const size_type position);
+
+    bool resize(const size_type count, const value_type& fillValue = value_type());
+    void clear();
+
+    void swap(StaticVector& swapVector) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>);
+
+    /*** Operations ***/
+    template<class U>
+    StaticVector& Fill(const U& fillValue);
+
+    template<class U>
+    StaticVector& Fill(const U& fillValue, const size_type startPos, const size_type endPos = SIZE);
+
+    template<class RuleT>
+    StaticVector& FillWithRule(const RuleT& predicate);
+
+    /*** Operators ***/
+    NODISCARD reference       operator[](const size_type index)         { return *slot(index); }    // Subscript for assignable reference
+    NODISCARD const_reference operator[](const size_type index) const   { return *slot(index); }    // Subscript for non-assignable reference
+
+    NODISCARD bool operator==(const StaticVector& rightVector) const;
+    NODISCARD bool operator!=(const StaticVector& rightVector) const    { return !(*this == rightVector); }
+
+    template<class U, std::size_t uSIZE>    // Compare with an Array, equal if the Array is fully occupied with equal elements
+    NODISCARD bool operator==(const Array<U, uSIZE>& rightArr) const;
+    template<class U, std::size_t uSIZE>
+    NODISCARD bool operator!=(const Array<U, uSIZE>& rightArr) const    { return !(*this == rightArr); }
+
+    StaticVector& operator=(const StaticVector& sourceVector) &;
+    StaticVector& operator=(StaticVector&& sourceVector) & noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /*** Status Checkers ***/
+    NODISCARD bool      empty()     const noexcept { return (0     == sz);     } // true if the StaticVector is empty
+    NODISCARD bool      full()      const noexcept { return (SIZE  == sz);     } // true if the StaticVector is full
+    NODISCARD size_type size()      const noexcept { return sz;                } // Current number of elements
+    NODISCARD size_type capacity()  const noexcept { return SIZE;              } // Maximum number of elements
+    NODISCARD size_type max_size()  const noexcept { return SIZE;              } // Maximum number of elements
+    NODISCARD size_type available() const noexcept { return (SIZE - sz);       } // Available slots in StaticVector
+    NODISCARD size_type sizeRaw()   const noexcept { return sz * sizeof(T);    } // Size of the live elements in bytes
+    NODISCARD static constexpr size_type footprint_bytes() noexcept { return sizeof(StaticVector); } // Memory taken by an instance, including bookkeeping and padding
+
+private:
+    /*** Members ***/
+    ContainerDetail::SmallestIndex<SIZE>    sz{0};          // Number of live elements
+    aligned_data                            storage[SIZE];  // Live elements followed by uninitialized slots
+
+    /*** Helper Functions ***/
+    NODISCARD const T* slot(const size_type slotIdx) const
+    {
+        return reinterpret_cast<const T*>(storage + slotIdx);
+    }
+
+    NODISCARD T* slot(const size_type slotIdx)
+    {
+        return reinterpret_cast<T*>(storage + slotIdx);
+    }
+};
+
+/**
+ * @brief   Fill constructor constructs the given number of copies of the fill value
+ * @param   count       Number of elements, limited to the capacity
+ * @param   fillValue   Reference fill value
+ */
+template<class T, std::size_t SIZE>
+StaticVector<T, SIZE>::StaticVector(const size_type count, const value_type& fillValue)
+{
+    resize(count, fillValue);
+}
+
+/**
+ * @brief   Iterator range constructor
+ * @param   first   Iterator to the first element to be copied
+ * @param   last    Iterator after the last element to be copied
+ * @note    Copying stops at the capacity, a single memcpy is used for the same trivially copyable types.
+ */
+template<class T, std::size_t SIZE>
+template<class InputIt, class>
+StaticVector<T, SIZE>::StaticVector(InputIt first, InputIt last)
+{
+    if constexpr(ContainerDetail::IsMemcpyable<T, InputIt>)
+    {
+        const size_type count = static_cast<size_type>(last - first);
+
+        ContainerDetail::ConstructRange(slot(0), first, (count < SIZE) ? count : SIZE);
+        sz = static_cast<decltype(sz)>((count < SIZE) ? count : SIZE);
+    }
+    else
+    {
+        for( ; (first != last) && !full(); ++first)
+            emplace_back(*first);
+    }
+}
+
+/**
+ * @brief Copy constructor
+ * @param copyVector    Source StaticVector for copying
+ */
+template<class T, std::size_t SIZE>
+StaticVector<T, SIZE>::StaticVector(const StaticVector& copyVector)
+{
+    *this = copyVector;
+}
+
+/**
+ * @brief Move constructor
+ * @param moveVector    Source StaticVector for moving, it is left empty
+ */
+template<class T, std::size_t SIZE>
+StaticVector<T, SIZE>::StaticVector(StaticVector&& moveVector) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    *this = std::move(moveVector);
+}
+
+/**
+ * @brief   Appends the element by constructing it in-place with the given arguments
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @return  true    If the operation is successful.
+ *          false   If the StaticVector was full
+ */
+template<class T, std::size_t SIZE>
+template<class... Args>
+bool StaticVector<T, SIZE>::emplace_back(Args&&... args)
+{
+    if(full())
+        return false;
+
+    new(storage + sz) value_type(std::forward<Args>(args)...);
+    ++sz;
+
+    return true;
+}
+
+/**
+ * @brief   Removes the last element
+ */
+template<class T, std::size_t SIZE>
+void StaticVector<T, SIZE>::pop_back()
+{
+    if(empty())
+        return;
+
+    --sz;
+    slot(sz)->~value_type();
+}
+
+/**
+ * @brief   Inserts the element at the given position by constructing it with the given arguments
+ * @param   position    Position of the new element, the following elements are shifted by one
+ * @param   args        Arguments to be forwarded to the constructor of the new element
+ * @return  true    If the operation is successful.
+ *          false   If the StaticVector was full or the position was beyond the end
+ * @note    The element is constructed before the shift, so the arguments may refer to the elements of the StaticVector.
+ */
+template<class T, std::size_t SIZE>
+template<class... Args>
+bool StaticVector<T, SIZE>::emplace(const size_type position, Args&&... args)
+{
+    if(full() || (position > sz))
+        return false;
+
+    value_type element(std::forward<Args>(args)...);
+
+    // Single memmove for trivially copyable types
+    ContainerDetail::OpenGap(slot(0), position, sz);
+    new(storage + position) value_type(std::move(element));
+    ++sz;
+
+    return true;
+}
+
+/**
+ * @brief   Removes the element at the given position, the following elements are shifted by one
+ * @param   position    Position of the element to be removed
+ * @note    The order of the elements is kept, see swap_remove(..) for an O(1) removal.
+ */
+template<class T, std::size_t SIZE>
+void StaticVector<T, SIZE>::erase(const size_type position)
+{
+    if(position >= sz)
+        return;
+
+    // Single memmove for trivially copyable types
+    ContainerDetail::CloseGap(slot(0), position, sz);
+    --sz;
+}
+
+/**
+ * @brief   Removes the elements in the given position range
+ * @param   startPos    Position of the first element to be removed
+ * @param   endPos      Position after the last element to be removed, limited to the size
+ */
+template<class T, std::size_t SIZE>
+void StaticVector<T, SIZE>::erase(const size_type startPos, const size_type endPos)
+{
+    const size_type lastPos = (endPos < sz) ? endPos : sz;
+
+    if(startPos >= lastPos)
+        return;
+
+    // Compiles to a memmove for trivially copyable types
+    std::move(slot(lastPos), slot(sz), slot(startPos));
+
+    const size_type newSize = sz - (lastPos - startPos);
+
+    ContainerDetail::DestroyRange(slot(newSize), sz - newSize);
+    sz = static_cast<decltype(sz)>(newSize);
+}
+
+/**
+ * @brief   Removes the element at the given position by moving the last element into its place
+ * @param   position    Position of the element to be removed
+ * @note    O(1), the order of the elements is not kept.
+ */
+template<class T, std::size_t SIZE>
+void StaticVector<T, SIZE>::swap_remove(const size_type position)
+{
+    if(position >= sz)
+        return;
+
+    --sz;
+
+    if(position != sz)
+        at(position) = std::move(*slot(sz));
+
+    slot(sz)->~value_type();
+}
+
+/**
+ * @brief   Changes the number of elements
+ * @param   count       New number of elements
+ * @param   fillValue   Value of the appended elements
+ * @return  true    If the operation is successful.
+ *          false   If the count exceeds the capacity, the StaticVector is filled up to the capacity
+ */
+template<class T, std::size_t SIZE>
+bool StaticVector<T, SIZE>::resize(const size_type count, const value_type& fillValue)
+{
+    const size_type newSize = (count < SIZE) ? count : SIZE;
+
+    if(newSize < sz)
+    {
+        ContainerDetail::DestroyRange(slot(newSize), sz - newSize);
+    }
+    else
+    {
+        for(size_type index = sz; index < newSize; ++index)
+            new(storage + index) value_type(fillValue);
+    }
+
+    sz = static_cast<decltype(sz)>(newSize);
+
+    return (count <= SIZE);
+}
+
+/**
+ * @brief   Removes all elements
+ */
+template<class T, std::size_t SIZE>
+void StaticVector<T, SIZE>::clear()
+{
+    // Compiles to nothing for trivially destructible types
+    ContainerDetail::DestroyRange(slot(0), sz);
+    sz = 0;
+}
+
+/**
+ * @brief   Swaps the contents of two StaticVectors
+ * @param   swapVector  StaticVector to be swapped with
+ */
+template<class T, std::size_t SIZE>
+void StaticVector<T, SIZE>::swap(StaticVector& swapVector) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>)
+{
+    if(this == &swapVector)
+        return;
+
+    StaticVector& longer    = (sz >= swapVector.sz) ? *this : swapVector;
+    StaticVector& shorter   = (sz >= swapVector.sz) ? swapVector : *this;
+    const size_type common  = shorter.sz;
+
+    for(size_type index = 0; index < common; ++index)
+        std::swap(longer.at(index), shorter.at(index));
+
+    // The elements without a counterpart are moved to the other side
+    ContainerDetail::RelocateRange(shorter.slot(common), longer.slot(common), longer.sz - common);
+
+    std::swap(sz, swapVector.sz);
+}
+
+/**
+ * @brief   Assigns the fill value to every element
+ * @param   fillValue   Reference fill value
+ * @return  lValue reference to the StaticVector to support cascaded calls.
+ * @note    Only the live elements are assigned, the size is not changed.
+ */
+template<class T, std::size_t SIZE>
+template<class U>
+StaticVector<T, SIZE>& StaticVector<T, SIZE>::Fill(const U& fillValue)
+{
+    return Fill(fillValue, 0, sz);
+}
+
+/**
+ * @brief   Assigns the fill value to the elements in the given position range
+ * @param   fillValue   Reference fill value
+ * @param   startPos    Start position for filling
+ * @param   endPos      End position for filling(excluded), limited to the size
+ * @return  lValue reference to the StaticVector to support cascaded calls.
+ * @note    Arithmetic types are filled with memset when the value is a repeated byte pattern.
+ */
+template<class T, std::size_t SIZE>
+template<class U>
+StaticVector<T, SIZE>& StaticVector<T, SIZE>::Fill(const U& fillValue, const size_type startPos, const size_type endPos)
+{
+    const size_type lastPos = (endPos < sz) ? endPos : sz;
+
+    if(startPos >= lastPos)
+        return *this;
+
+    if constexpr(std::is_same_v<T, U> && std::is_arithmetic_v<T>)
+    {
+        if(ContainerDetail::FillBytes(slot(startPos), lastPos - startPos, fillValue))
+            return *this;
+    }
+
+    for(size_type index = startPos; index < lastPos; ++index)
+        at(index) = fillValue;
+
+    return *this;
+}
+
+/**
+ * @brief   Position based fill operation
+ * @param   predicate   Rule for calculating the element value using its position.
+ * @return  lValue reference to the StaticVector to support cascaded calls.
+ * @note    Only the live elements are assigned, the size is not changed.
+ */
+template<class T, std::size_t SIZE>
+template<class RuleT>
+StaticVector<T, SIZE>& StaticVector<T, SIZE>::FillWithRule(const RuleT& predicate)
+{
+    for(size_type index = 0; index < sz; ++index)
+        at(index) = predicate(index);
+
+    return *this;
+}
+
+/**
+ * @brief   Comparison operator
+ * @param   rightVector     StaticVector to be compared with
+ * @return  true            If both have the same size and equal elements
+ */
+template<class T, std::size_t SIZE>
+bool StaticVector<T, SIZE>::operator==(const StaticVector& rightVector) const
+{
+    if(sz != rightVector.sz)
+        return false;
+
+    for(size_type index = 0; index < sz; ++index)
+    {
+        if(!(at(index) == rightVector.at(index)))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Comparison operator against an Array
+ * @param   rightArr    Array to be compared with
+ * @return  true        If the size is the same as the Array's and the elements are equal
+ */
+template<class T, std::size_t SIZE>
+template<class U, std::size_t uSIZE>
+bool StaticVector<T, SIZE>::operator==(const Array<U, uSIZE>& rightArr) const
+{
+    if(sz != uSIZE)
+        return false;
+
+    for(size_type index = 0; index < sz; ++index)
+    {
+        if(!(at(index) == rightArr[index]))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Copy assignment operator
+ * @param   sourceVector    StaticVector to be copied from
+ * @return  lValue reference to the left StaticVector to support cascaded operations
+ */
+template<class T, std::size_t SIZE>
+StaticVector<T, SIZE>& StaticVector<T, SIZE>::operator=(const StaticVector& sourceVector) &
+{
+    if(this == &sourceVector)   // Check self copy
+        return *this;
+
+    clear();
+
+    // Single memcpy for trivially copyable types
+    ContainerDetail::ConstructRange(slot(0), sourceVector.slot(0), sourceVector.sz);
+    sz = sourceVector.sz;
+
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator
+ * @param   sourceVector    StaticVector to be moved from, it is left empty
+ * @return  lValue reference to the left StaticVector to support cascaded operations
+ */
+template<class T, std::size_t SIZE>
+StaticVector<T, SIZE>& StaticVector<T, SIZE>::operator=(StaticVector&& sourceVector) & noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if(this == &sourceVector)   // Check self move
+        return *this;
+
+    clear();
+
+    // Single memcpy for trivially copyable types
+    ContainerDetail::RelocateRange(slot(0), sourceVector.slot(0), sourceVector.sz);
+    sz              = sourceVector.sz;
+    sourceVector.sz = 0;
+
+    return *this;
+}